@@ -0,0 +1,129 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "audio/aheadbuffer.h"
+
+#include "common/util.h"
+
+namespace Audio {
+
+AheadBuffer::AheadBuffer(uint size, uint chunkSize) :
+		_chunkSize(chunkSize), _readPos(0), _filled(0), _ended(false) {
+	assert(chunkSize > 0 && !(chunkSize & 1));
+
+	// Keep a whole number of stereo frames in the buffer
+	_size = MAX(size + (size & 1), chunkSize);
+
+	_buffer = new int16[_size];
+	_scratch = new int16[_chunkSize];
+}
+
+AheadBuffer::~AheadBuffer() {
+	delete[] _buffer;
+	delete[] _scratch;
+}
+
+void AheadBuffer::fill(uint maxSamples) {
+	uint produced = 0;
+	while (produced < maxSamples) {
+		// Only hold the producer lock for one chunk at a time, so that an
+		// underrunning read() never waits for more than one chunk
+		Common::StackLock produceLock(_produceMutex);
+		uint writePos;
+
+		{
+			Common::StackLock bufferLock(_bufferMutex);
+			if (_ended || _size - _filled < _chunkSize)
+				break;
+
+			writePos = (_readPos + _filled) % _size;
+		}
+
+		// Produce outside of the buffer lock, so that read() can keep
+		// copying out samples in the meantime
+		const uint count = MAX(produce(_scratch, _chunkSize), 0);
+
+		const uint firstPart = MIN(count, _size - writePos);
+		memcpy(_buffer + writePos, _scratch, firstPart * sizeof(int16));
+		memcpy(_buffer, _scratch + firstPart, (count - firstPart) * sizeof(int16));
+
+		Common::StackLock bufferLock(_bufferMutex);
+		_filled += count;
+		_ended = producerEnded();
+
+		// Try again on the next call if the producer has nothing for us
+		if (!count)
+			break;
+
+		produced += count;
+	}
+}
+
+uint AheadBuffer::readBuffered(int16 *buffer, uint numSamples) {
+	Common::StackLock bufferLock(_bufferMutex);
+
+	const uint count = MIN(numSamples, _filled);
+	const uint firstPart = MIN(count, _size - _readPos);
+	memcpy(buffer, _buffer + _readPos, firstPart * sizeof(int16));
+	memcpy(buffer + firstPart, _buffer, (count - firstPart) * sizeof(int16));
+
+	_readPos = (_readPos + count) % _size;
+	_filled -= count;
+
+	return count;
+}
+
+uint AheadBuffer::read(int16 *buffer, uint numSamples) {
+	uint count = readBuffered(buffer, numSamples);
+
+	if (count < numSamples) {
+		// The producer fell behind. Produce the rest here, after picking
+		// up anything that got produced in the meantime.
+		Common::StackLock produceLock(_produceMutex);
+		count += readBuffered(buffer + count, numSamples - count);
+
+		if (count < numSamples && !_ended) {
+			count += MAX(produce(buffer + count, numSamples - count), 0);
+
+			Common::StackLock bufferLock(_bufferMutex);
+			_ended = producerEnded();
+		}
+	}
+
+	return count;
+}
+
+bool AheadBuffer::isFinished() const {
+	Common::StackLock bufferLock(_bufferMutex);
+	return _ended && !_filled;
+}
+
+DecodeAheadAudioStream::DecodeAheadAudioStream(AudioStream *parentStream, uint aheadTime, DisposeAfterUse::Flag disposeAfterUse) :
+		AheadBuffer(bufferSize(parentStream, aheadTime), kDecodeChunkSize),
+		_parentStream(parentStream, disposeAfterUse), _isStereo(parentStream->isStereo()), _rate(parentStream->getRate()) {
+}
+
+uint DecodeAheadAudioStream::bufferSize(const AudioStream *stream, uint aheadTime) {
+	return (stream->getRate() * aheadTime / 1000) * (stream->isStereo() ? 2 : 1);
+}
+
+} // End of namespace Audio
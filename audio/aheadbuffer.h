@@ -0,0 +1,149 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef AUDIO_AHEADBUFFER_H
+#define AUDIO_AHEADBUFFER_H
+
+#include "common/mutex.h"
+#include "common/ptr.h"
+#include "common/types.h"
+
+#include "audio/audiostream.h"
+
+namespace Audio {
+
+/**
+ * A ring buffer of samples which are produced ahead of playback, usually
+ * from a timer callback, so that the mixer callback only has to copy them
+ * out. Subclasses implement produce() to generate the samples.
+ *
+ * There is no portable thread or atomics support, so the buffer positions
+ * are protected by a mutex which is only held while copying. The producer
+ * runs under a second mutex, outside of the buffer lock.
+ */
+class AheadBuffer {
+public:
+	/**
+	 * @param size      The buffer size in samples
+	 * @param chunkSize How many samples are produced at a time (an even
+	 *                  number, so stereo frames are never split)
+	 */
+	AheadBuffer(uint size, uint chunkSize);
+	virtual ~AheadBuffer();
+
+	/**
+	 * Produce up to maxSamples samples into the buffer, in whole chunks,
+	 * while there is room for them.
+	 */
+	void fill(uint maxSamples);
+
+	/**
+	 * Read samples from the buffer. If the producer fell behind, the
+	 * missing samples are produced directly into the given buffer.
+	 *
+	 * @return the number of samples read
+	 */
+	uint read(int16 *buffer, uint numSamples);
+
+	/** Whether the producer ended and all its samples have been read. */
+	bool isFinished() const;
+
+	/** Return the buffer size in samples. */
+	uint getSize() const { return _size; }
+
+protected:
+	/**
+	 * Produce up to numSamples samples. Calls are serialized.
+	 *
+	 * @return the number of samples produced
+	 */
+	virtual int produce(int16 *buffer, int numSamples) = 0;
+
+	/** Whether the producer will not produce any more samples. */
+	virtual bool producerEnded() const { return false; }
+
+private:
+	uint readBuffered(int16 *buffer, uint numSamples);
+
+	Common::Mutex _produceMutex;        // Serializes produce()
+	mutable Common::Mutex _bufferMutex; // Protects the buffer positions
+	int16 *_buffer;
+	int16 *_scratch;
+	uint _size;
+	uint _chunkSize;
+	uint _readPos;
+	uint _filled;
+	bool _ended;
+};
+
+/**
+ * An AudioStream wrapper which decodes its parent stream ahead of
+ * playback. The owner calls decodeAhead() regularly, usually from a timer
+ * callback, so that reading from the stream in the mixer callback usually
+ * only has to copy samples out of a buffer. Useful for compressed streams
+ * (MP3, Ogg Vorbis, FLAC) whose decoding may occasionally take longer than
+ * the mixer callback allows.
+ *
+ * Nothing is decoded until the first decodeAhead() call. If the decoding
+ * falls behind, the missing samples are decoded when they are read, as
+ * they would be without the wrapper. Such a read waits for at most one
+ * kDecodeChunkSize chunk of a running decodeAhead() call, not for all of
+ * it.
+ *
+ * The wrapper cannot seek, since that would throw the buffer away. To
+ * loop, wrap a looping stream instead.
+ */
+class DecodeAheadAudioStream : public AudioStream, private AheadBuffer {
+public:
+	/**
+	 * @param parentStream    The stream to decode ahead
+	 * @param aheadTime       How many milliseconds to decode ahead
+	 * @param disposeAfterUse Whether the parent stream object should be destroyed on destruction of this stream
+	 */
+	DecodeAheadAudioStream(AudioStream *parentStream, uint aheadTime, DisposeAfterUse::Flag disposeAfterUse = DisposeAfterUse::YES);
+
+	int readBuffer(int16 *buffer, const int numSamples) { return read(buffer, numSamples); }
+	bool endOfData() const { return isFinished(); }
+	bool isStereo() const { return _isStereo; }
+	int getRate() const { return _rate; }
+
+	/** Top up the buffer. */
+	void decodeAhead() { fill(getSize()); }
+
+private:
+	enum {
+		kDecodeChunkSize = 2048 // Samples decoded ahead at a time (an even number, for stereo)
+	};
+
+	static uint bufferSize(const AudioStream *stream, uint aheadTime);
+
+	int produce(int16 *buffer, int numSamples) { return _parentStream->readBuffer(buffer, numSamples); }
+	bool producerEnded() const { return _parentStream->endOfData(); }
+
+	Common::DisposablePtr<AudioStream> _parentStream;
+	const bool _isStereo;
+	const int _rate;
+};
+
+} // End of namespace Audio
+
+#endif
@@ -0,0 +1,177 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "audio/audiocache.h"
+#include "audio/audiostream.h"
+#include "audio/decoders/raw.h"
+
+#include "common/config-manager.h"
+#include "common/memstream.h"
+
+namespace Common {
+DECLARE_SINGLETON(Audio::DecodedAudioCache);
+}
+
+namespace Audio {
+
+enum {
+	kDefaultCacheSize = 4096 // KB
+};
+
+struct DecodedAudioCache::Entry {
+	DecodedAudioKey key;
+	byte *data;
+	uint32 size;
+	int rate;
+	byte flags;
+
+	/** Number of streams currently playing this entry. */
+	uint refCount;
+	/** Whether the entry is still part of the cache. */
+	bool cached;
+};
+
+/**
+ * Memory stream over the data of a cache entry, which keeps the entry
+ * alive while it is in use.
+ */
+class CachedAudioReadStream : public Common::MemoryReadStream {
+public:
+	CachedAudioReadStream(DecodedAudioCache::Entry *entry)
+		: Common::MemoryReadStream(entry->data, entry->size, DisposeAfterUse::NO), _entry(entry) {}
+
+	~CachedAudioReadStream() {
+		DecodedAudioCacheMan.releaseEntry(_entry);
+	}
+
+private:
+	DecodedAudioCache::Entry *_entry;
+};
+
+DecodedAudioCache::DecodedAudioCache() : _usedSize(0), _hits(0), _misses(0) {
+}
+
+DecodedAudioCache::~DecodedAudioCache() {
+	clear();
+}
+
+uint32 DecodedAudioCache::getMaxSize() const {
+	int size = kDefaultCacheSize;
+	if (ConfMan.hasKey("audio_cache_size"))
+		size = ConfMan.getInt("audio_cache_size");
+
+	return size > 0 ? (uint32)size * 1024 : 0;
+}
+
+SeekableAudioStream *DecodedAudioCache::createStream(const DecodedAudioKey &key) {
+	Common::StackLock lock(_mutex);
+
+	EntryMap::iterator it = _entries.find(key);
+	if (it == _entries.end()) {
+		_misses++;
+		return 0;
+	}
+
+	_hits++;
+
+	// Move the entry to the front of the LRU list
+	Entry *entry = it->_value;
+	_lru.remove(entry);
+	_lru.push_front(entry);
+
+	return createStream(entry);
+}
+
+SeekableAudioStream *DecodedAudioCache::addAndCreateStream(const DecodedAudioKey &key, byte *data, uint32 size, int rate, byte flags) {
+	const uint32 maxSize = getMaxSize();
+
+	if (size > maxSize)
+		return makeRawStream(data, size, rate, flags, DisposeAfterUse::YES);
+
+	Common::StackLock lock(_mutex);
+
+	// Replace any stale entry for the same key
+	EntryMap::iterator it = _entries.find(key);
+	if (it != _entries.end())
+		removeEntry(it->_value);
+
+	evict(maxSize - size);
+
+	Entry *entry = new Entry();
+	entry->key = key;
+	entry->data = data;
+	entry->size = size;
+	entry->rate = rate;
+	entry->flags = flags;
+	entry->refCount = 0;
+	entry->cached = true;
+
+	_entries[key] = entry;
+	_lru.push_front(entry);
+	_usedSize += size;
+
+	return createStream(entry);
+}
+
+void DecodedAudioCache::clear() {
+	Common::StackLock lock(_mutex);
+
+	while (!_lru.empty())
+		removeEntry(_lru.back());
+}
+
+void DecodedAudioCache::releaseEntry(Entry *entry) {
+	Common::StackLock lock(_mutex);
+
+	assert(entry->refCount > 0);
+	entry->refCount--;
+
+	if (!entry->refCount && !entry->cached) {
+		free(entry->data);
+		delete entry;
+	}
+}
+
+SeekableAudioStream *DecodedAudioCache::createStream(Entry *entry) {
+	entry->refCount++;
+	return makeRawStream(new CachedAudioReadStream(entry), entry->rate, entry->flags, DisposeAfterUse::YES);
+}
+
+void DecodedAudioCache::evict(uint32 maxSize) {
+	while (_usedSize > maxSize && !_lru.empty())
+		removeEntry(_lru.back());
+}
+
+void DecodedAudioCache::removeEntry(Entry *entry) {
+	_entries.erase(entry->key);
+	_lru.remove(entry);
+	_usedSize -= entry->size;
+	entry->cached = false;
+
+	// Entries which are still being played are freed by the last stream
+	if (!entry->refCount) {
+		free(entry->data);
+		delete entry;
+	}
+}
+
+} // End of namespace Audio
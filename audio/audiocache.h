@@ -0,0 +1,139 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef AUDIO_AUDIOCACHE_H
+#define AUDIO_AUDIOCACHE_H
+
+#include "common/hash-str.h"
+#include "common/hashmap.h"
+#include "common/list.h"
+#include "common/mutex.h"
+#include "common/singleton.h"
+#include "common/str.h"
+#include "common/types.h"
+
+namespace Audio {
+
+class SeekableAudioStream;
+
+/**
+ * Identifies a piece of decoded audio data: the archive member it was
+ * read from, the location of the encoded data inside that member and
+ * the codec used to decode it.
+ */
+struct DecodedAudioKey {
+	Common::String member;
+	uint32 offset;
+	uint32 length;
+	uint32 codec;
+
+	DecodedAudioKey() : offset(0), length(0), codec(0) {}
+	DecodedAudioKey(const Common::String &m, uint32 o, uint32 l, uint32 c)
+		: member(m), offset(o), length(l), codec(c) {}
+
+	bool operator==(const DecodedAudioKey &other) const {
+		return offset == other.offset && length == other.length &&
+		       codec == other.codec && member == other.member;
+	}
+};
+
+struct DecodedAudioKey_Hash {
+	uint operator()(const DecodedAudioKey &x) const {
+		return Common::hashit(x.member.c_str()) ^ (x.offset * 31) ^ (x.length * 17) ^ x.codec;
+	}
+};
+
+/**
+ * A size bounded, least recently used cache of fully decoded PCM data.
+ *
+ * Engines which decode the same compressed sound effects or speech
+ * samples over and over again can store the decoded data here and get
+ * a cheap raw stream over the shared buffer on subsequent plays. The
+ * size budget is taken from the "audio_cache_size" config key (in KB).
+ * Evicted buffers stay alive until the last stream playing them has
+ * been deleted.
+ */
+class DecodedAudioCache : public Common::Singleton<DecodedAudioCache> {
+public:
+	~DecodedAudioCache();
+
+	/**
+	 * Create a stream playing the cached data for the given key.
+	 *
+	 * @return the new stream, or 0 if the key is not cached.
+	 */
+	SeekableAudioStream *createStream(const DecodedAudioKey &key);
+
+	/**
+	 * Add decoded PCM data to the cache and create a stream playing it.
+	 * The cache takes ownership of the buffer, which must have been
+	 * allocated with malloc(). If the data does not fit into the cache,
+	 * the returned stream simply owns the buffer.
+	 *
+	 * @param key   key identifying the data
+	 * @param data  decoded PCM data
+	 * @param size  size of the data in bytes
+	 * @param rate  sample rate of the data
+	 * @param flags Audio::RawFlags describing the data
+	 * @return the new stream
+	 */
+	SeekableAudioStream *addAndCreateStream(const DecodedAudioKey &key, byte *data, uint32 size, int rate, byte flags);
+
+	/** Drop all unused entries from the cache. */
+	void clear();
+
+	uint32 getHits() const { return _hits; }
+	uint32 getMisses() const { return _misses; }
+	uint32 getUsedSize() const { return _usedSize; }
+	uint32 getEntryCount() const { return _entries.size(); }
+	uint32 getMaxSize() const;
+
+	struct Entry;
+
+	/** Called by cached streams when they are deleted. */
+	void releaseEntry(Entry *entry);
+
+private:
+	friend class Common::Singleton<SingletonBaseType>;
+	DecodedAudioCache();
+
+	typedef Common::HashMap<DecodedAudioKey, Entry *, DecodedAudioKey_Hash> EntryMap;
+	typedef Common::List<Entry *> EntryList;
+
+	SeekableAudioStream *createStream(Entry *entry);
+	void evict(uint32 maxSize);
+	void removeEntry(Entry *entry);
+
+	Common::Mutex _mutex;
+	EntryMap _entries;
+	EntryList _lru;
+	uint32 _usedSize;
+	uint32 _hits;
+	uint32 _misses;
+};
+
+} // End of namespace Audio
+
+/** Shortcut for accessing the decoded audio cache. */
+#define DecodedAudioCacheMan Audio::DecodedAudioCache::instance()
+
+#endif
@@ -46,14 +46,24 @@ ADPCMStream::ADPCMStream(Common::SeekableReadStream *stream, DisposeAfterUse::Fl
 		_endpos(_startpos + size),
 		_channels(channels),
 		_blockAlign(blockAlign),
-		_rate(rate) {
+		_rate(rate),
+		_blockData(0),
+		_blockSamples(0),
+		_blockSampleCount(0),
+		_blockSamplePos(0) {
 
 	reset();
 }
 
+ADPCMStream::~ADPCMStream() {
+	delete[] _blockData;
+	delete[] _blockSamples;
+}
+
 void ADPCMStream::reset() {
 	memset(&_status, 0, sizeof(_status));
 	_blockPos[0] = _blockPos[1] = _blockAlign; // To make sure first header is read
+	_blockSampleCount = _blockSamplePos = 0;
 }
 
 bool ADPCMStream::rewind() {
@@ -63,6 +73,35 @@ bool ADPCMStream::rewind() {
 	return true;
 }
 
+int ADPCMStream::readBlockBuffer(int16 *buffer, const int numSamples) {
+	int samples = 0;
+
+	while (samples < numSamples) {
+		if (_blockSamplePos == _blockSampleCount) {
+			if (_stream->eos() || _stream->pos() >= _endpos)
+				break;
+
+			if (!_blockData) {
+				_blockData = new byte[_blockAlign];
+				_blockSamples = new int16[_blockAlign * 2];
+			}
+
+			// The last block may be cut short
+			const uint32 size = _stream->read(_blockData, MIN<uint32>(_blockAlign, _endpos - _stream->pos()));
+			_blockSampleCount = decodeBlock(_blockData, size, _blockSamples);
+			_blockSamplePos = 0;
+			continue;
+		}
+
+		const uint32 count = MIN<uint32>(numSamples - samples, _blockSampleCount - _blockSamplePos);
+		memcpy(buffer + samples, _blockSamples + _blockSamplePos, count * sizeof(int16));
+		_blockSamplePos += count;
+		samples += count;
+	}
+
+	return samples;
+}
+
 
 #pragma mark -
 
@@ -213,42 +252,42 @@ int MSIma_ADPCMStream::readBuffer(int16 *buffer, const int numSamples) {
 	// Need to write at least one sample per channel
 	assert((numSamples % _channels) == 0);
 
-	int samples = 0;
+	return readBlockBuffer(buffer, numSamples);
+}
 
-	while (samples < numSamples && !_stream->eos() && _stream->pos() < _endpos) {
-		if (_blockPos[0] == _blockAlign) {
-			for (int i = 0; i < _channels; i++) {
-				// read block header
-				_status.ima_ch[i].last = _stream->readSint16LE();
-				_status.ima_ch[i].stepIndex = _stream->readSint16LE();
-			}
+uint32 MSIma_ADPCMStream::decodeBlock(const byte *data, uint32 size, int channels, int16 *output) {
+	if (size < (uint32)channels * 4)
+		return 0;
 
-			_blockPos[0] = _channels * 4;
-		}
+	int32 last[2], stepIndex[2];
+
+	// Block header
+	for (int i = 0; i < channels; i++) {
+		last[i] = (int16)READ_LE_UINT16(data);
+		stepIndex[i] = CLIP<int32>((int16)READ_LE_UINT16(data + 2), 0, ARRAYSIZE(_imaTable) - 1);
+		data += 4;
+	}
+
+	// The stream encodes four bytes (eight samples) per channel at a time
+	const uint32 groups = (size - channels * 4) / (channels * 4);
+
+	for (uint32 group = 0; group < groups; group++) {
+		for (int i = 0; i < channels; i++) {
+			int16 *out = output + i;
 
-		// Decode a set of samples
-		for (int i = 0; i < _channels; i++) {
-			// The stream encodes four bytes per channel at a time
 			for (int j = 0; j < 4; j++) {
-				byte data = _stream->readByte();
-				_blockPos[0]++;
-				_buffer[i][j * 2] = decodeIMA(data & 0x0f, i);
-				_buffer[i][j * 2 + 1] = decodeIMA((data >> 4) & 0x0f, i);
-				_samplesLeft[i] += 2;
+				const byte code = *data++;
+				*out = decodeIMANibble(last[i], stepIndex[i], code & 0x0f);
+				out += channels;
+				*out = decodeIMANibble(last[i], stepIndex[i], code >> 4);
+				out += channels;
 			}
 		}
 
-		while (samples < numSamples && _samplesLeft[0] != 0) {
-			for (int i = 0; i < _channels; i++) {
-				buffer[samples + i] = _buffer[i][8 - _samplesLeft[i]];
-				_samplesLeft[i]--;
-			}
-
-			samples += _channels;
-		}
+		output += 8 * channels;
 	}
 
-	return samples;
+	return groups * 8 * channels;
 }
 
 
@@ -287,48 +326,46 @@ int16 MS_ADPCMStream::decodeMS(ADPCMChannelStatus *c, byte code) {
 }
 
 int MS_ADPCMStream::readBuffer(int16 *buffer, const int numSamples) {
-	int samples;
-	byte data;
+	return readBlockBuffer(buffer, numSamples);
+}
+
+uint32 MS_ADPCMStream::decodeBlock(const byte *data, uint32 size, int channels, int16 *output) {
+	if (size < (uint32)channels * 7)
+		return 0;
+
+	ADPCMChannelStatus status[2];
 	int i;
 
-	for (samples = 0; samples < numSamples && !endOfData(); samples++) {
-		if (_decodedSampleCount == 0) {
-			if (_blockPos[0] == _blockAlign) {
-				// read block header
-				for (i = 0; i < _channels; i++) {
-					_status.ch[i].predictor = CLIP(_stream->readByte(), (byte)0, (byte)6);
-					_status.ch[i].coeff1 = MSADPCMAdaptCoeff1[_status.ch[i].predictor];
-					_status.ch[i].coeff2 = MSADPCMAdaptCoeff2[_status.ch[i].predictor];
-				}
-
-				for (i = 0; i < _channels; i++)
-					_status.ch[i].delta = _stream->readSint16LE();
-
-				for (i = 0; i < _channels; i++)
-					_status.ch[i].sample1 = _stream->readSint16LE();
-
-				for (i = 0; i < _channels; i++)
-					_decodedSamples[_decodedSampleCount++] = _status.ch[i].sample2 = _stream->readSint16LE();
-
-				for (i = 0; i < _channels; i++)
-					_decodedSamples[_decodedSampleCount++] = _status.ch[i].sample1;
-
-				_blockPos[0] = _channels * 7;
-			} else {
-				data = _stream->readByte();
-				_blockPos[0]++;
-				_decodedSamples[_decodedSampleCount++] = decodeMS(&_status.ch[0], (data >> 4) & 0x0f);
-				_decodedSamples[_decodedSampleCount++] = decodeMS(&_status.ch[_channels - 1], data & 0x0f);
-			}
-			_decodedSampleIndex = 0;
-		}
+	// Block header
+	for (i = 0; i < channels; i++) {
+		status[i].predictor = CLIP(*data++, (byte)0, (byte)6);
+		status[i].coeff1 = MSADPCMAdaptCoeff1[status[i].predictor];
+		status[i].coeff2 = MSADPCMAdaptCoeff2[status[i].predictor];
+	}
 
-		// _decodedSamples acts as a FIFO of depth 2 or 4;
-		buffer[samples] = _decodedSamples[_decodedSampleIndex++];
-		_decodedSampleCount--;
+	for (i = 0; i < channels; i++, data += 2)
+		status[i].delta = READ_LE_UINT16(data);
+
+	for (i = 0; i < channels; i++, data += 2)
+		status[i].sample1 = READ_LE_UINT16(data);
+
+	for (i = 0; i < channels; i++, data += 2)
+		*output++ = status[i].sample2 = READ_LE_UINT16(data);
+
+	for (i = 0; i < channels; i++)
+		*output++ = status[i].sample1;
+
+	// Each byte holds one sample for each channel (or two for mono)
+	const uint32 bytes = size - channels * 7;
+	ADPCMChannelStatus *second = &status[channels - 1];
+
+	for (uint32 j = 0; j < bytes; j++) {
+		const byte code = *data++;
+		*output++ = decodeMS(&status[0], (code >> 4) & 0x0f);
+		*output++ = decodeMS(second, code & 0x0f);
 	}
 
-	return samples;
+	return channels * 2 + bytes * 2;
 }
 
 
@@ -423,15 +460,7 @@ const int16 Ima_ADPCMStream::_imaTable[89] = {
 };
 
 int16 Ima_ADPCMStream::decodeIMA(byte code, int channel) {
-	int32 E = (2 * (code & 0x7) + 1) * _imaTable[_status.ima_ch[channel].stepIndex] / 8;
-	int32 diff = (code & 0x08) ? -E : E;
-	int32 samp = CLIP<int32>(_status.ima_ch[channel].last + diff, -32768, 32767);
-
-	_status.ima_ch[channel].last = samp;
-	_status.ima_ch[channel].stepIndex += _stepAdjustTable[code];
-	_status.ima_ch[channel].stepIndex = CLIP<int32>(_status.ima_ch[channel].stepIndex, 0, ARRAYSIZE(_imaTable) - 1);
-
-	return samp;
+	return decodeIMANibble(_status.ima_ch[channel].last, _status.ima_ch[channel].stepIndex, code);
 }
 
 SeekableAudioStream *makeADPCMStream(Common::SeekableReadStream *stream, DisposeAfterUse::Flag disposeAfterUse, uint32 size, ADPCMType type, int rate, int channels, uint32 blockAlign) {
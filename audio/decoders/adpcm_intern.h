@@ -36,6 +36,7 @@
 #include "common/ptr.h"
 #include "common/stream.h"
 #include "common/textconsole.h"
+#include "common/util.h"
 
 namespace Audio {
 
@@ -59,8 +60,24 @@ protected:
 
 	virtual void reset();
 
+	/**
+	 * Fill the buffer from whole blocks decoded with decodeBlock().
+	 * Used by the formats which consist of self-contained blocks of
+	 * blockAlign bytes, so that a block is read and decoded in one go
+	 * instead of nibble by nibble.
+	 */
+	int readBlockBuffer(int16 *buffer, const int numSamples);
+	bool blockBufferEmpty() const { return _blockSamplePos == _blockSampleCount; }
+
+	/**
+	 * Decode one block of data. Returns the number of samples written,
+	 * which is at most twice the size of the block.
+	 */
+	virtual uint32 decodeBlock(const byte *data, uint32 size, int16 *output) { return 0; }
+
 public:
 	ADPCMStream(Common::SeekableReadStream *stream, DisposeAfterUse::Flag disposeAfterUse, uint32 size, int rate, int channels, uint32 blockAlign);
+	virtual ~ADPCMStream();
 
 	virtual bool endOfData() const { return (_stream->eos() || _stream->pos() >= _endpos); }
 	virtual bool isStereo() const { return _channels == 2; }
@@ -78,6 +95,12 @@ public:
 	 * 4-bit nibble, it is more efficient to just keep it as it is.
 	 */
 	static const int16 _stepAdjustTable[16];
+
+private:
+	byte *_blockData;
+	int16 *_blockSamples;
+	uint32 _blockSampleCount;
+	uint32 _blockSamplePos;
 };
 
 class Oki_ADPCMStream : public ADPCMStream {
@@ -101,6 +124,18 @@ class Ima_ADPCMStream : public ADPCMStream {
 protected:
 	int16 decodeIMA(byte code, int channel = 0); // Default to using the left channel/using one channel
 
+	static inline int16 decodeIMANibble(int32 &last, int32 &stepIndex, byte code) {
+		int32 E = (2 * (code & 0x7) + 1) * _imaTable[stepIndex] / 8;
+		int32 diff = (code & 0x08) ? -E : E;
+		int32 samp = CLIP<int32>(last + diff, -32768, 32767);
+
+		last = samp;
+		stepIndex += _stepAdjustTable[code];
+		stepIndex = CLIP<int32>(stepIndex, 0, ARRAYSIZE(_imaTable) - 1);
+
+		return samp;
+	}
+
 public:
 	Ima_ADPCMStream(Common::SeekableReadStream *stream, DisposeAfterUse::Flag disposeAfterUse, uint32 size, int rate, int channels, uint32 blockAlign)
 		: ADPCMStream(stream, disposeAfterUse, size, rate, channels, blockAlign) {}
@@ -164,21 +199,22 @@ public:
 		if (blockAlign % (_channels * 4))
 			error("MSIma_ADPCMStream(): invalid blockAlign");
 
-		_samplesLeft[0] = 0;
-		_samplesLeft[1] = 0;
 	}
 
+	virtual bool endOfData() const { return Ima_ADPCMStream::endOfData() && blockBufferEmpty(); }
+
 	virtual int readBuffer(int16 *buffer, const int numSamples);
 
-	void reset() {
-		Ima_ADPCMStream::reset();
-		_samplesLeft[0] = 0;
-		_samplesLeft[1] = 0;
-	}
+protected:
+	/**
+	 * Decode a whole block of MS IMA ADPCM data, including its header,
+	 * into interleaved samples.
+	 *
+	 * @return the number of samples written
+	 */
+	static uint32 decodeBlock(const byte *data, uint32 size, int channels, int16 *output);
 
-private:
-	int16 _buffer[2][8];
-	int _samplesLeft[2];
+	uint32 decodeBlock(const byte *data, uint32 size, int16 *output) { return decodeBlock(data, size, _channels, output); }
 };
 
 class MS_ADPCMStream : public ADPCMStream {
@@ -192,37 +228,29 @@ protected:
 		int16 sample2;
 	};
 
-	struct {
-		// MS ADPCM
-		ADPCMChannelStatus ch[2];
-	} _status;
-
-	void reset() {
-		ADPCMStream::reset();
-		memset(&_status, 0, sizeof(_status));
-	}
-
 public:
 	MS_ADPCMStream(Common::SeekableReadStream *stream, DisposeAfterUse::Flag disposeAfterUse, uint32 size, int rate, int channels, uint32 blockAlign)
 		: ADPCMStream(stream, disposeAfterUse, size, rate, channels, blockAlign) {
 		if (blockAlign == 0)
 			error("MS_ADPCMStream(): blockAlign isn't specified for MS ADPCM");
-		memset(&_status, 0, sizeof(_status));
-		_decodedSampleCount = 0;
-		_decodedSampleIndex = 0;
 	}
 
-	virtual bool endOfData() const { return (_stream->eos() || _stream->pos() >= _endpos) && (_decodedSampleCount == 0); }
+	virtual bool endOfData() const { return ADPCMStream::endOfData() && blockBufferEmpty(); }
 
 	virtual int readBuffer(int16 *buffer, const int numSamples);
 
 protected:
-	int16 decodeMS(ADPCMChannelStatus *c, byte);
+	/**
+	 * Decode a whole block of MS ADPCM data, including its header, into
+	 * interleaved samples.
+	 *
+	 * @return the number of samples written
+	 */
+	static uint32 decodeBlock(const byte *data, uint32 size, int channels, int16 *output);
 
-private:
-	uint8 _decodedSampleCount;
-	uint8 _decodedSampleIndex;
-	int16 _decodedSamples[4];
+	static int16 decodeMS(ADPCMChannelStatus *c, byte);
+
+	uint32 decodeBlock(const byte *data, uint32 size, int16 *output) { return decodeBlock(data, size, _channels, output); }
 };
 
 // Duck DK3 IMA ADPCM Decoder
@@ -264,7 +264,9 @@ EmulatedOPL::EmulatedOPL() :
 	_nextTick(0),
 	_samplesPerTick(0),
 	_baseFreq(0),
-	_handle(new Audio::SoundHandle()) {
+	_handle(new Audio::SoundHandle()),
+	_queueWrites(false),
+	_callbackSample(0) {
 }
 
 EmulatedOPL::~EmulatedOPL() {
@@ -279,31 +281,78 @@ EmulatedOPL::~EmulatedOPL() {
 
 int EmulatedOPL::readBuffer(int16 *buffer, const int numSamples) {
 	const int stereoFactor = isStereo() ? 2 : 1;
-	int len = numSamples / stereoFactor;
+	const int len = numSamples / stereoFactor;
+	int pos = 0;
 	int step;
 
+	// Run all callbacks due within this buffer first. Their register
+	// writes are queued with the sample they are due at.
 	do {
-		step = len;
+		step = len - pos;
 		if (step > (_nextTick >> FIXP_SHIFT))
 			step = (_nextTick >> FIXP_SHIFT);
 
-		generateSamples(buffer, step * stereoFactor);
+		pos += step;
 
 		_nextTick -= step << FIXP_SHIFT;
 		if (!(_nextTick >> FIXP_SHIFT)) {
-			if (_callback && _callback->isValid())
+			if (_callback && _callback->isValid()) {
+				{
+					Common::StackLock lock(_writeQueueMutex);
+					_queueWrites = true;
+					_callbackSample = pos;
+				}
 				(*_callback)();
+				{
+					Common::StackLock lock(_writeQueueMutex);
+					_queueWrites = false;
+				}
+			}
 
 			_nextTick += _samplesPerTick;
 		}
+	} while (pos < len);
+
+	// Then render the output in blocks between the writes, so the emulator
+	// is only split up where the sound actually changes
+	Common::StackLock lock(_writeQueueMutex);
+
+	int rendered = 0;
+	for (uint i = 0; i < _writeQueue.size(); ++i) {
+		const RegisterWrite &write = _writeQueue[i];
+		if (write.sample > rendered) {
+			generateSamples(buffer + rendered * stereoFactor, (write.sample - rendered) * stereoFactor);
+			rendered = write.sample;
+		}
+
+		applySoundRegister(write.r, write.v);
+	}
 
-		buffer += step * stereoFactor;
-		len -= step;
-	} while (len);
+	if (rendered < len)
+		generateSamples(buffer + rendered * stereoFactor, (len - rendered) * stereoFactor);
+
+	// Keep the storage around; this happens for every buffer
+	_writeQueue.resize(0);
 
 	return numSamples;
 }
 
+void EmulatedOPL::writeSoundRegister(int r, int v) {
+	{
+		Common::StackLock lock(_writeQueueMutex);
+		if (_queueWrites) {
+			RegisterWrite write;
+			write.sample = _callbackSample;
+			write.r = r;
+			write.v = v;
+			_writeQueue.push_back(write);
+			return;
+		}
+	}
+
+	applySoundRegister(r, v);
+}
+
 int EmulatedOPL::getRate() const {
 	return g_system->getMixer()->getOutputRate();
 }
@@ -25,7 +25,9 @@
 
 #include "audio/audiostream.h"
 
+#include "common/array.h"
 #include "common/func.h"
+#include "common/mutex.h"
 #include "common/ptr.h"
 #include "common/scummsys.h"
 
@@ -267,6 +269,25 @@ protected:
 	 */
 	virtual void generateSamples(int16 *buffer, int numSamples) = 0;
 
+	/**
+	 * Write to a sound register of the emulated chip.
+	 *
+	 * Writes made from the callback are queued with the sample they are
+	 * due at, and applied once the output has been rendered up to that
+	 * sample. This lets readBuffer() run the callbacks first and then
+	 * render the output in blocks between the writes, instead of once per
+	 * callback. Other writes are applied right away.
+	 *
+	 * Registers which affect reads (like the timer registers) must not go
+	 * through here, since a read would not see a queued write.
+	 */
+	void writeSoundRegister(int r, int v);
+
+	/**
+	 * Apply a sound register write to the emulated chip.
+	 */
+	virtual void applySoundRegister(int r, int v) = 0;
+
 private:
 	int _baseFreq;
 
@@ -278,6 +299,17 @@ private:
 	int _samplesPerTick;
 
 	Audio::SoundHandle *_handle;
+
+	struct RegisterWrite {
+		int sample; ///< Sample of the current buffer the write is due at
+		int r;
+		int v;
+	};
+
+	Common::Array<RegisterWrite> _writeQueue;
+	bool _queueWrites;    ///< True while the callbacks run, i.e. while writes are queued
+	int _callbackSample;  ///< Sample the running callback is due at
+	Common::Mutex _writeQueueMutex;
 };
 
 } // End of namespace OPL
@@ -119,6 +119,23 @@ public:
 	 */
 	virtual void sysEx(const byte *msg, uint16 length) { }
 
+	/**
+	 * Output a packed midi command which is due the given number of
+	 * microseconds after the current timer callback started.
+	 *
+	 * MIDI parsers process all events of a timer period at once, at the
+	 * start of the period. Drivers which render their output from within
+	 * their own timer callback can use the delay to play the event at the
+	 * exact sample it is due. By default, the command is sent right away.
+	 */
+	virtual void sendDelayed(uint32 b, uint32 delay) { send(b); }
+
+	/**
+	 * Transmit a sysEx which is due the given number of microseconds after
+	 * the current timer callback started. See sendDelayed().
+	 */
+	virtual void sysExDelayed(const byte *msg, uint16 length, uint32 delay) { sysEx(msg, length); }
+
 	// TODO: Document this.
 	virtual void metaEvent(byte type, byte *data, uint16 length) { }
 };
@@ -45,6 +45,7 @@ _sendSustainOffOnNotesOff(false),
 _numTracks(0),
 _activeTrack(255),
 _abortParse(false),
+_eventDelay(0),
 _jumpingToTick(false) {
 	memset(_activeNotes, 0, sizeof(_activeNotes));
 	memset(_tracks, 0, sizeof(_tracks));
@@ -72,7 +73,7 @@ void MidiParser::property(int prop, int value) {
 }
 
 void MidiParser::sendToDriver(uint32 b) {
-	_driver->send(b);
+	_driver->sendDelayed(b, _eventDelay);
 }
 
 void MidiParser::setTempo(uint32 tempo) {
@@ -170,6 +171,7 @@ void MidiParser::onTimer() {
 		return;
 
 	_abortParse = false;
+	_eventDelay = 0;
 	endTime = _position._playTime + _timerRate;
 
 	// Scan our hanging notes for any
@@ -180,7 +182,9 @@ void MidiParser::onTimer() {
 		for (i = ARRAYSIZE(_hangingNotes); i; --i, ++ptr) {
 			if (ptr->timeLeft) {
 				if (ptr->timeLeft <= _timerRate) {
+					_eventDelay = ptr->timeLeft;
 					sendToDriver(0x80 | ptr->channel, ptr->note, 0);
+					_eventDelay = 0;
 					ptr->timeLeft = 0;
 					--_hangingNotesCount;
 				} else {
@@ -214,12 +218,21 @@ void MidiParser::onTimer() {
 				activeNote(info.channel(), info.basic.param1, true);
 		}
 
+		// Events are processed ahead of time; tell the driver when this
+		// one is actually due
+		_eventDelay = eventTime > _position._playTime ? eventTime - _position._playTime : 0;
+
 		// Player::metaEvent() in SCUMM will delete the parser object,
-		// so return immediately if that might have happened.
+		// so return immediately if that might have happened. The delay was
+		// reset by processEvent() in that case.
 		bool ret = processEvent(info);
 		if (!ret)
 			return;
 
+		// The delay only applies to this one event. Anything sent later,
+		// like the notes off of stopPlaying(), is sent right away.
+		_eventDelay = 0;
+
 		if (!_abortParse) {
 			_position._lastEventTime = eventTime;
 			parseNextEvent(_nextEvent);
@@ -238,15 +251,18 @@ bool MidiParser::processEvent(const EventInfo &info, bool fireEvents) {
 		// Check for trailing 0xF7 -- if present, remove it.
 		if (fireEvents) {
 			if (info.ext.data[info.length-1] == 0xF7)
-				_driver->sysEx(info.ext.data, (uint16)info.length-1);
+				_driver->sysExDelayed(info.ext.data, (uint16)info.length-1, _eventDelay);
 			else
-				_driver->sysEx(info.ext.data, (uint16)info.length);
+				_driver->sysExDelayed(info.ext.data, (uint16)info.length, _eventDelay);
 		}
 	} else if (info.event == 0xFF) {
 		// META event
 		if (info.ext.type == 0x2F) {
 			// End of Track must be processed by us,
 			// as well as sending it to the output device.
+			// The parser may be gone once we return, so the delay cannot
+			// be reset by onTimer().
+			_eventDelay = 0;
 			if (_autoLoop) {
 				jumpToTick(0);
 				parseNextEvent(_nextEvent);
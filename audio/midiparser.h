@@ -287,6 +287,7 @@ protected:
 	                        ///< so each event is parsed only once; this permits
 	                        ///< simulated events in certain formats.
 	bool   _abortParse;    ///< If a jump or other operation interrupts parsing, flag to abort.
+	uint32 _eventDelay;    ///< Time in microseconds from the start of the current onTimer() call until the event being sent is due. Only non-zero while onTimer() sends that event.
 	bool   _jumpingToTick; ///< True if currently inside jumpToTick
 
 protected:
@@ -2,6 +2,8 @@ MODULE := audio
 
 MODULE_OBJS := \
 	adlib.o \
+	aheadbuffer.o \
+	audiocache.o \
 	audiostream.o \
 	fmopl.o \
 	mididrv.o \
@@ -41,6 +43,7 @@ MODULE_OBJS := \
 	mods/soundfx.o \
 	mods/tfmx.o \
 	softsynth/cms.o \
+	softsynth/emumidi.o \
 	softsynth/opl/dbopl.o \
 	softsynth/opl/dosbox.o \
 	softsynth/opl/mame.o \
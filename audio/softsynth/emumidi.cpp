@@ -0,0 +1,186 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "audio/softsynth/emumidi.h"
+
+MidiDriver_Emulated::MidiDriver_Emulated(Audio::Mixer *mixer) :
+	_mixer(mixer),
+	_isOpen(false),
+	_timerProc(0),
+	_timerParam(0),
+	_nextTick(0),
+	_samplesPerTick(0),
+	_nextDelayedEvent(0),
+	_inTimerCallback(false),
+	_tickSamples(0),
+	_baseFreq(250) {
+}
+
+int MidiDriver_Emulated::open() {
+	_isOpen = true;
+
+	int d = getRate() / _baseFreq;
+	int r = getRate() % _baseFreq;
+
+	// This is equivalent to (getRate() << FIXP_SHIFT) / BASE_FREQ
+	// but less prone to arithmetic overflow.
+
+	_samplesPerTick = (d << FIXP_SHIFT) + (r << FIXP_SHIFT) / _baseFreq;
+
+	return 0;
+}
+
+uint32 MidiDriver_Emulated::delayToSamples(uint32 delay) const {
+	uint32 offset = (uint32)((uint64)delay * getRate() / 1000000);
+
+	// Anything due at the end of the tick (or later) is played right
+	// before the next timer callback
+	const uint32 tickLength = _samplesPerTick >> FIXP_SHIFT;
+	return MIN(offset, tickLength);
+}
+
+void MidiDriver_Emulated::queueDelayedEvent(DelayedEvent &event) {
+	// Events have to be played in the order they were sent. The parser
+	// sends them in order of their due time anyway, but anything sent
+	// without a delay (like all notes off) must not overtake events which
+	// were queued before it.
+	if (_delayedEvents.size() > _nextDelayedEvent)
+		event.offset = MAX(event.offset, _delayedEvents.back().offset);
+
+	_delayedEvents.push_back(event);
+}
+
+void MidiDriver_Emulated::sendDelayed(uint32 b, uint32 delay) {
+	{
+		Common::StackLock lock(_delayedEventsMutex);
+		if (_inTimerCallback) {
+			// Queue even events without a delay, at the start of the tick,
+			// so that they stay in order with the delayed ones
+			DelayedEvent event;
+			event.offset = delayToSamples(delay);
+			event.b = b;
+			event.sysExPos = 0;
+			event.sysExLength = 0;
+			event.isSysEx = false;
+
+			queueDelayedEvent(event);
+			return;
+		}
+	}
+
+	send(b);
+}
+
+void MidiDriver_Emulated::sysExDelayed(const byte *msg, uint16 length, uint32 delay) {
+	{
+		Common::StackLock lock(_delayedEventsMutex);
+		if (_inTimerCallback) {
+			DelayedEvent event;
+			event.offset = delayToSamples(delay);
+			event.b = 0;
+			event.sysExPos = _delayedSysExData.size();
+			event.sysExLength = length;
+			event.isSysEx = true;
+
+			_delayedSysExData.resize(event.sysExPos + length);
+			memcpy(&_delayedSysExData[event.sysExPos], msg, length);
+
+			queueDelayedEvent(event);
+			return;
+		}
+	}
+
+	sysEx(msg, length);
+}
+
+uint32 MidiDriver_Emulated::sendDelayedEvents(uint32 upTo) {
+	Common::StackLock lock(_delayedEventsMutex);
+
+	while (_nextDelayedEvent < _delayedEvents.size() && _delayedEvents[_nextDelayedEvent].offset <= upTo) {
+		const DelayedEvent &event = _delayedEvents[_nextDelayedEvent++];
+		if (event.isSysEx)
+			sysEx(&_delayedSysExData[event.sysExPos], event.sysExLength);
+		else
+			send(event.b);
+	}
+
+	if (_nextDelayedEvent < _delayedEvents.size())
+		return _delayedEvents[_nextDelayedEvent].offset - upTo;
+
+	if (_nextDelayedEvent) {
+		// Keep the storage around; this happens every tick
+		_delayedEvents.resize(0);
+		_delayedSysExData.resize(0);
+		_nextDelayedEvent = 0;
+	}
+
+	return 0xFFFFFFFF;
+}
+
+int MidiDriver_Emulated::readBuffer(int16 *data, const int numSamples) {
+	const int stereoFactor = isStereo() ? 2 : 1;
+	int len = numSamples / stereoFactor;
+	int step;
+
+	do {
+		step = len;
+		if (step > (_nextTick >> FIXP_SHIFT))
+			step = (_nextTick >> FIXP_SHIFT);
+
+		// Split the block at the next delayed event, so that it starts
+		// playing at the right sample
+		const uint32 untilEvent = sendDelayedEvents(_tickSamples);
+		if ((uint32)step > untilEvent)
+			step = untilEvent;
+
+		generateSamples(data, step);
+
+		_tickSamples += step;
+		_nextTick -= step << FIXP_SHIFT;
+		if (!(_nextTick >> FIXP_SHIFT)) {
+			// Whatever is still pending is due by now
+			sendDelayedEvents(0xFFFFFFFF);
+			_tickSamples = 0;
+
+			if (_timerProc) {
+				{
+					Common::StackLock lock(_delayedEventsMutex);
+					_inTimerCallback = true;
+				}
+				(*_timerProc)(_timerParam);
+				{
+					Common::StackLock lock(_delayedEventsMutex);
+					_inTimerCallback = false;
+				}
+			}
+
+			onTimer();
+
+			_nextTick += _samplesPerTick;
+		}
+
+		data += step * stereoFactor;
+		len -= step;
+	} while (len);
+
+	return numSamples;
+}
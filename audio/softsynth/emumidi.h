@@ -27,6 +27,9 @@
 #include "audio/mididrv.h"
 #include "audio/mixer.h"
 
+#include "common/array.h"
+#include "common/mutex.h"
+
 class MidiDriver_Emulated : public Audio::AudioStream, public MidiDriver {
 protected:
 	bool _isOpen;
@@ -44,6 +47,32 @@ private:
 	int _nextTick;
 	int _samplesPerTick;
 
+	/**
+	 * A MIDI event sent by the timer callback which is due later in the
+	 * current tick. sysExPos/sysExLength refer to _delayedSysExData.
+	 */
+	struct DelayedEvent {
+		uint32 offset; ///< Sample offset from the start of the tick
+		uint32 b;
+		uint32 sysExPos;
+		uint16 sysExLength;
+		bool isSysEx;
+	};
+
+	// The timer callback and the engine may send events from different
+	// threads, so the queue and _inTimerCallback are protected by the mutex
+	Common::Array<DelayedEvent> _delayedEvents;
+	Common::Array<byte> _delayedSysExData;
+	uint _nextDelayedEvent;
+	bool _inTimerCallback; ///< True while the timer callback runs, i.e. while events are queued
+	Common::Mutex _delayedEventsMutex;
+
+	uint32 _tickSamples;   ///< Samples generated since the timer callback last ran
+
+	uint32 delayToSamples(uint32 delay) const;
+	void queueDelayedEvent(DelayedEvent &event);
+	uint32 sendDelayedEvents(uint32 upTo);
+
 protected:
 	int _baseFreq;
 
@@ -51,30 +80,10 @@ protected:
 	virtual void onTimer() {}
 
 public:
-	MidiDriver_Emulated(Audio::Mixer *mixer) :
-		_mixer(mixer),
-		_isOpen(false),
-		_timerProc(0),
-		_timerParam(0),
-		_nextTick(0),
-		_samplesPerTick(0),
-		_baseFreq(250) {
-	}
+	MidiDriver_Emulated(Audio::Mixer *mixer);
 
 	// MidiDriver API
-	virtual int open() {
-		_isOpen = true;
-
-		int d = getRate() / _baseFreq;
-		int r = getRate() % _baseFreq;
-
-		// This is equivalent to (getRate() << FIXP_SHIFT) / BASE_FREQ
-		// but less prone to arithmetic overflow.
-
-		_samplesPerTick = (d << FIXP_SHIFT) + (r << FIXP_SHIFT) / _baseFreq;
-
-		return 0;
-	}
+	virtual int open();
 
 	bool isOpen() const { return _isOpen; }
 
@@ -87,35 +96,17 @@ public:
 		return 1000000 / _baseFreq;
 	}
 
-	// AudioStream API
-	virtual int readBuffer(int16 *data, const int numSamples) {
-		const int stereoFactor = isStereo() ? 2 : 1;
-		int len = numSamples / stereoFactor;
-		int step;
-
-		do {
-			step = len;
-			if (step > (_nextTick >> FIXP_SHIFT))
-				step = (_nextTick >> FIXP_SHIFT);
-
-			generateSamples(data, step);
-
-			_nextTick -= step << FIXP_SHIFT;
-			if (!(_nextTick >> FIXP_SHIFT)) {
-				if (_timerProc)
-					(*_timerProc)(_timerParam);
+	/**
+	 * Events sent from within the timer callback are played at the sample
+	 * they are due at, instead of at the start of the tick, and always in
+	 * the order they were sent. Events from anywhere else are sent right
+	 * away.
+	 */
+	virtual void sendDelayed(uint32 b, uint32 delay);
+	virtual void sysExDelayed(const byte *msg, uint16 length, uint32 delay);
 
-				onTimer();
-
-				_nextTick += _samplesPerTick;
-			}
-
-			data += step * stereoFactor;
-			len -= step;
-		} while (len);
-
-		return numSamples;
-	}
+	// AudioStream API
+	virtual int readBuffer(int16 *data, const int numSamples);
 
 	virtual bool endOfData() const {
 		return false;
@@ -38,6 +38,7 @@ public:
 	void updatePhaseIncrement();
 	void recalculateRates();
 	void generateOutput(int32 phasebuf, int32 *feedbuf, int32 &out);
+	bool isSilent() const { return _state == kEnvReady; }
 
 	void feedbackLevel(int32 level);
 	void detune(int value);
@@ -860,6 +861,7 @@ TownsPC98_FmSynth::TownsPC98_FmSynth(Audio::Mixer *mixer, EmuType type, bool ext
 	_numChan(type == kType26 ? 3 : 6), _numSSG(type == kTypeTowns ? 0 : 3),
 	_hasPercussion(type == kType86 ? true : false),
 	_oprRates(0), _oprRateshift(0), _oprAttackDecay(0), _oprFrq(0), _oprSinTbl(0), _oprLevelOut(0), _oprDetune(0),
+	_mixBuffer(0), _mixBufferSize(0),
 	 _rtt(type == kTypeTowns ? 0x514767 : 0x5B8D80), _baserate(55125.0f / (float)mixer->getOutputRate()),
 	_volMaskA(0), _volMaskB(0), _volumeA(255), _volumeB(255),
 	_regProtectionFlag(false), _externalMutex(externalMutexHandling), _ready(false) {
@@ -890,6 +892,7 @@ TownsPC98_FmSynth::~TownsPC98_FmSynth() {
 	delete[] _oprSinTbl;
 	delete[] _oprLevelOut;
 	delete[] _oprDetune;
+	delete[] _mixBuffer;
 }
 
 bool TownsPC98_FmSynth::init() {
@@ -1143,8 +1146,15 @@ void TownsPC98_FmSynth::writeReg(uint8 part, uint8 regAddress, uint8 value) {
 
 int TownsPC98_FmSynth::readBuffer(int16 *buffer, const int numSamples) {
 	memset(buffer, 0, sizeof(int16) * numSamples);
-	int32 *tmp = new int32[numSamples];
-	int32 *tmpStart = tmp;
+
+	// Only the mixer thread calls us, so the buffer needs no locking
+	if (numSamples > _mixBufferSize) {
+		delete[] _mixBuffer;
+		_mixBuffer = new int32[numSamples];
+		_mixBufferSize = numSamples;
+	}
+
+	int32 *tmp = _mixBuffer;
 	memset(tmp, 0, sizeof(int32) * numSamples);
 	int32 samplesLeft = numSamples >> 1;
 
@@ -1218,8 +1228,6 @@ int TownsPC98_FmSynth::readBuffer(int16 *buffer, const int numSamples) {
 	if (locked)
 		_mutex.unlock();
 
-	delete[] tmpStart;
-
 	return numSamples;
 }
 
@@ -1364,16 +1372,34 @@ void TownsPC98_FmSynth::nextTick(int32 *buffer, uint32 bufferSize) {
 				o[ii]->updatePhaseIncrement();
 		}
 
+		int32 *del = &_chanInternal[i].feedbuf[2];
+		int32 *feed = _chanInternal[i].feedbuf;
+
+		// Operators only get keyed on between blocks. If all of them are
+		// idle, they neither advance nor produce output for the whole block,
+		// and every algorithm just clears the delay buffer.
+		if (o[0]->isSilent() && o[1]->isSilent() && o[2]->isSilent() && o[3]->isSilent()) {
+			if (bufferSize)
+				*del = 0;
+			continue;
+		}
+
+		// These stay the same for the whole block
+		const uint8 algorithm = _chanInternal[i].algorithm;
+		const int32 divisor = (_numChan + _numSSG - 3) / 3;
+		const bool useVolumeA = ((1 << i) & _volMaskA) != 0;
+		const bool useVolumeB = ((1 << i) & _volMaskB) != 0;
+		const bool enableLeft = _chanInternal[i].enableLeft;
+		const bool enableRight = _chanInternal[i].enableRight;
+
 		for (uint32 ii = 0; ii < bufferSize ; ii++) {
 			int32 phbuf1, phbuf2, output;
 			phbuf1 = phbuf2 = output = 0;
 
 			int32 *leftSample = &buffer[ii * 2];
 			int32 *rightSample = &buffer[ii * 2 + 1];
-			int32 *del = &_chanInternal[i].feedbuf[2];
-			int32 *feed = _chanInternal[i].feedbuf;
 
-			switch (_chanInternal[i].algorithm) {
+			switch (algorithm) {
 			case 0:
 				o[0]->generateOutput(0, feed, phbuf1);
 				o[2]->generateOutput(*del, 0, phbuf2);
@@ -1432,18 +1458,18 @@ void TownsPC98_FmSynth::nextTick(int32 *buffer, uint32 bufferSize) {
 				break;
 			};
 
-			int32 finOut = (output << 2) / ((_numChan + _numSSG - 3) / 3);
+			int32 finOut = (output << 2) / divisor;
 
-			if ((1 << i) & _volMaskA)
+			if (useVolumeA)
 				finOut = (finOut * _volumeA) / Audio::Mixer::kMaxMixerVolume;
 
-			if ((1 << i) & _volMaskB)
+			if (useVolumeB)
 				finOut = (finOut * _volumeB) / Audio::Mixer::kMaxMixerVolume;
 
-			if (_chanInternal[i].enableLeft)
+			if (enableLeft)
 				*leftSample += finOut;
 
-			if (_chanInternal[i].enableRight)
+			if (enableRight)
 				*rightSample += finOut;
 		}
 	}
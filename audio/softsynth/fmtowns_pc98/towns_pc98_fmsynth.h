@@ -145,6 +145,10 @@ private:
 	int32 *_oprLevelOut;
 	int32 *_oprDetune;
 
+	// Mixing buffer, kept around between readBuffer() calls
+	int32 *_mixBuffer;
+	int _mixBufferSize;
+
 	bool _regProtectionFlag;
 
 	typedef void (TownsPC98_FmSynth::*ChipTimerProc)();
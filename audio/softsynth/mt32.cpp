@@ -26,6 +26,7 @@
 #ifdef USE_MT32EMU
 
 #include "audio/softsynth/emumidi.h"
+#include "audio/aheadbuffer.h"
 #include "audio/musicplugin.h"
 #include "audio/mpu401.h"
 
@@ -38,6 +39,7 @@
 #include "common/util.h"
 #include "common/archive.h"
 #include "common/textconsole.h"
+#include "common/timer.h"
 #include "common/translation.h"
 #include "common/osd_message_queue.h"
 
@@ -102,6 +104,25 @@ class MidiChannel_MT32 : public MidiChannel_MPU401 {
 	void chorusLevel(byte value) { }
 };
 
+class MidiDriver_MT32;
+
+// Renders the MT-32 emulation (and the MIDI timer driving it) ahead of
+// playback, so that readBuffer() only has to copy the samples out
+class MT32RenderAheadBuffer : public Audio::AheadBuffer {
+public:
+	enum {
+		kRenderChunkSize = 1024 // Samples rendered ahead at a time (stereo, so an even number)
+	};
+
+	MT32RenderAheadBuffer(MidiDriver_MT32 *driver, uint size) : Audio::AheadBuffer(size, kRenderChunkSize), _driver(driver) {}
+
+protected:
+	int produce(int16 *buffer, int numSamples);
+
+private:
+	MidiDriver_MT32 *_driver;
+};
+
 class MidiDriver_MT32 : public MidiDriver_Emulated {
 private:
 	MidiChannel_MT32 _midiChannels[16];
@@ -113,6 +134,13 @@ private:
 
 	int _outputRate;
 
+	MT32RenderAheadBuffer *_renderAhead;
+
+	void startRenderAhead(uint latency);
+	void stopRenderAhead();
+	static void renderAheadProc(void *refCon);
+	void renderAhead();
+
 protected:
 	void generateSamples(int16 *buf, int len);
 
@@ -131,6 +159,7 @@ public:
 	MidiChannel *getPercussionChannel();
 
 	// AudioStream API
+	int readBuffer(int16 *data, const int numSamples);
 	bool isStereo() const { return true; }
 	int getRate() const { return _outputRate; }
 };
@@ -150,6 +179,7 @@ MidiDriver_MT32::MidiDriver_MT32(Audio::Mixer *mixer) : MidiDriver_Emulated(mixe
 	_outputRate = 0;
 	_controlData = nullptr;
 	_pcmData = nullptr;
+	_renderAhead = nullptr;
 }
 
 MidiDriver_MT32::~MidiDriver_MT32() {
@@ -221,6 +251,11 @@ int MidiDriver_MT32::open() {
 
 	MidiDriver_Emulated::open();
 
+	// Optionally trade some latency for rendering outside of the mixer
+	// callback, to avoid underruns with small audio buffers
+	if (ConfMan.hasKey("mt32_render_ahead") && ConfMan.getInt("mt32_render_ahead") > 0)
+		startRenderAhead(ConfMan.getInt("mt32_render_ahead"));
+
 	_mixer->playStream(Audio::Mixer::kPlainSoundType, &_mixerSoundHandle, this, -1, Audio::Mixer::kMaxChannelVolume, 0, DisposeAfterUse::NO, true);
 
 	return 0;
@@ -266,10 +301,13 @@ void MidiDriver_MT32::close() {
 		return;
 	_isOpen = false;
 
+	// Detach the mixer callback handler first, so readBuffer() can no
+	// longer touch the render-ahead buffer
+	_mixer->stopHandle(_mixerSoundHandle);
+	// Stop rendering ahead, which also runs the player callback
+	stopRenderAhead();
 	// Detach the player callback handler
 	setTimerCallback(NULL, NULL);
-	// Detach the mixer callback handler
-	_mixer->stopHandle(_mixerSoundHandle);
 
 	Common::StackLock lock(_mutex);
 	_service.closeSynth();
@@ -285,6 +323,55 @@ void MidiDriver_MT32::generateSamples(int16 *data, int len) {
 	_service.renderBit16s(data, len);
 }
 
+void MidiDriver_MT32::startRenderAhead(uint latency) {
+	_renderAhead = new MT32RenderAheadBuffer(this, (_outputRate * latency / 1000) * 2);
+
+	debug(4, "MT-32 emulator rendering %d ms ahead", latency);
+
+	// Top up the buffer twice per latency period
+	renderAhead();
+	g_system->getTimerManager()->installTimerProc(&renderAheadProc, MAX<uint>(latency * 500, 10000), this, "MT32RenderAhead");
+}
+
+void MidiDriver_MT32::stopRenderAhead() {
+	if (!_renderAhead)
+		return;
+
+	// The mixer handle is stopped already, and once the proc is removed
+	// nothing else touches the buffer. The timer manager holds its own
+	// lock while running renderAhead(), so the proc must not be removed
+	// while holding a lock renderAhead() takes.
+	g_system->getTimerManager()->removeTimerProc(&renderAheadProc);
+
+	delete _renderAhead;
+	_renderAhead = nullptr;
+}
+
+void MidiDriver_MT32::renderAheadProc(void *refCon) {
+	((MidiDriver_MT32 *)refCon)->renderAhead();
+}
+
+void MidiDriver_MT32::renderAhead() {
+	// This runs on the timer thread shared with every other timer proc,
+	// which are all held up while the synth renders. Only render about as
+	// much as playback consumes between two calls (half of the buffer), so
+	// a single call never renders the whole buffer after an underrun.
+	_renderAhead->fill(_renderAhead->getSize() / 2);
+}
+
+int MT32RenderAheadBuffer::produce(int16 *buffer, int numSamples) {
+	// This also runs the MIDI timer, so events stay in sync with the
+	// rendered samples
+	return _driver->MidiDriver_Emulated::readBuffer(buffer, numSamples);
+}
+
+int MidiDriver_MT32::readBuffer(int16 *data, const int numSamples) {
+	if (!_renderAhead)
+		return MidiDriver_Emulated::readBuffer(data, numSamples);
+
+	return _renderAhead->read(data, numSamples);
+}
+
 uint32 MidiDriver_MT32::property(int prop, uint32 param) {
 	switch (prop) {
 	case PROP_CHANNEL_MASK:
@@ -271,43 +271,20 @@ void Partial::backupCache(const PatchCache &cache) {
 	}
 }
 
-bool Partial::produceOutput(Sample *leftBuf, Sample *rightBuf, Bit32u length) {
-	if (!isActive() || alreadyOutputed || isRingModulatingSlave()) {
-		return false;
-	}
-	if (poly == NULL) {
-		synth->printDebug("[Partial %d] *** ERROR: poly is NULL at Partial::produceOutput()!", debugPartialNum);
-		return false;
-	}
-	alreadyOutputed = true;
+// Number of samples generated before they get panned and mixed into the output buffers.
+// Keeping the mixing in a separate tight loop over a small block lets the compiler vectorise it.
+static const Bit32u PRODUCE_BLOCK_SIZE = 64;
 
-	for (sampleNum = 0; sampleNum < length; sampleNum++) {
-		if (!tva->isPlaying() || !la32Pair.isActive(LA32PartialPair::MASTER)) {
-			deactivate();
-			break;
-		}
-		la32Pair.generateNextSample(LA32PartialPair::MASTER, getAmpValue(), tvp->nextPitch(), getCutoffValue());
-		if (hasRingModulatingSlave()) {
-			la32Pair.generateNextSample(LA32PartialPair::SLAVE, pair->getAmpValue(), pair->tvp->nextPitch(), pair->getCutoffValue());
-			if (!pair->tva->isPlaying() || !la32Pair.isActive(LA32PartialPair::SLAVE)) {
-				pair->deactivate();
-				if (mixType == 2) {
-					deactivate();
-					break;
-				}
-			}
-		}
-
-		// Although, LA32 applies panning itself, we assume here it is applied in the mixer, not within a pair.
-		// Applying the pan value in the log-space looks like a waste of unlog resources. Though, it needs clarification.
-		Sample sample = la32Pair.nextOutSample();
+static void mixPannedSamples(const Sample *block, Bit32u length, Sample *leftBuf, Sample *rightBuf, Bit32s leftPanValue, Bit32s rightPanValue) {
+	for (Bit32u i = 0; i < length; i++) {
+		Sample sample = block[i];
 
 		// FIXME: Sample analysis suggests that the use of panVal is linear, but there are some quirks that still need to be resolved.
 #if MT32EMU_USE_FLOAT_SAMPLES
 		Sample leftOut = (sample * (float)leftPanValue) / 14.0f;
 		Sample rightOut = (sample * (float)rightPanValue) / 14.0f;
-		*(leftBuf++) += leftOut;
-		*(rightBuf++) += rightOut;
+		leftBuf[i] += leftOut;
+		rightBuf[i] += rightOut;
 #else
 		// FIXME: Dividing by 7 (or by 14 in a Mok-friendly way) looks of course pointless. Need clarification.
 		// FIXME2: LA32 may produce distorted sound in case if the absolute value of maximal amplitude of the input exceeds 8191
@@ -318,12 +295,61 @@ bool Partial::produceOutput(Sample *leftBuf, Sample *rightBuf, Bit32u length) {
 		// Though, it is unknown whether this overflow is exploited somewhere.
 		Sample leftOut = Sample((sample * leftPanValue) >> 8);
 		Sample rightOut = Sample((sample * rightPanValue) >> 8);
-		*leftBuf = Synth::clipSampleEx(SampleEx(*leftBuf) + SampleEx(leftOut));
-		*rightBuf = Synth::clipSampleEx(SampleEx(*rightBuf) + SampleEx(rightOut));
-		leftBuf++;
-		rightBuf++;
+		leftBuf[i] = Synth::clipSampleEx(SampleEx(leftBuf[i]) + SampleEx(leftOut));
+		rightBuf[i] = Synth::clipSampleEx(SampleEx(rightBuf[i]) + SampleEx(rightOut));
 #endif
 	}
+}
+
+bool Partial::produceOutput(Sample *leftBuf, Sample *rightBuf, Bit32u length) {
+	if (!isActive() || alreadyOutputed || isRingModulatingSlave()) {
+		return false;
+	}
+	if (poly == NULL) {
+		synth->printDebug("[Partial %d] *** ERROR: poly is NULL at Partial::produceOutput()!", debugPartialNum);
+		return false;
+	}
+	alreadyOutputed = true;
+
+	Sample block[PRODUCE_BLOCK_SIZE];
+	bool stopped = false;
+	sampleNum = 0;
+	while (!stopped && sampleNum < length) {
+		Bit32u blockLength = length - sampleNum;
+		if (blockLength > PRODUCE_BLOCK_SIZE) {
+			blockLength = PRODUCE_BLOCK_SIZE;
+		}
+
+		// Generate the samples of this block first, then pan and mix them all at once
+		Bit32u produced = 0;
+		for (; produced < blockLength; produced++, sampleNum++) {
+			if (!tva->isPlaying() || !la32Pair.isActive(LA32PartialPair::MASTER)) {
+				deactivate();
+				stopped = true;
+				break;
+			}
+			la32Pair.generateNextSample(LA32PartialPair::MASTER, getAmpValue(), tvp->nextPitch(), getCutoffValue());
+			if (hasRingModulatingSlave()) {
+				la32Pair.generateNextSample(LA32PartialPair::SLAVE, pair->getAmpValue(), pair->tvp->nextPitch(), pair->getCutoffValue());
+				if (!pair->tva->isPlaying() || !la32Pair.isActive(LA32PartialPair::SLAVE)) {
+					pair->deactivate();
+					if (mixType == 2) {
+						deactivate();
+						stopped = true;
+						break;
+					}
+				}
+			}
+
+			// Although, LA32 applies panning itself, we assume here it is applied in the mixer, not within a pair.
+			// Applying the pan value in the log-space looks like a waste of unlog resources. Though, it needs clarification.
+			block[produced] = la32Pair.nextOutSample();
+		}
+
+		mixPannedSamples(block, produced, leftBuf, rightBuf, leftPanValue, rightPanValue);
+		leftBuf += produced;
+		rightBuf += produced;
+	}
 	sampleNum = 0;
 	return true;
 }
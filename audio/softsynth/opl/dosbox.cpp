@@ -189,8 +189,15 @@ void OPL::write(int port, int val) {
 		switch (_type) {
 		case Config::kOpl2:
 		case Config::kOpl3:
-			if (!_chip[0].write(_reg.normal, val))
+			if (_chip[0].write(_reg.normal, val))
+				break;
+
+			// The OPL3 mode register changes how addresses are written,
+			// so it cannot wait in the queue
+			if (_reg.normal == 0x105)
 				_emulator->WriteReg(_reg.normal, val);
+			else
+				writeSoundRegister(_reg.normal, val);
 			break;
 		case Config::kDualOpl2:
 			// Not a 0x??8 port, then write to a specific port
@@ -306,7 +313,11 @@ void OPL::dualWrite(uint8 index, uint8 reg, uint8 val) {
 	}
 
 	uint32 fullReg = reg + (index ? 0x100 : 0);
-	_emulator->WriteReg(fullReg, val);
+	writeSoundRegister(fullReg, val);
+}
+
+void OPL::applySoundRegister(int r, int v) {
+	_emulator->WriteReg(r, v);
 }
 
 void OPL::generateSamples(int16 *buffer, int length) {
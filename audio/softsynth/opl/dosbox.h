@@ -99,6 +99,7 @@ public:
 
 protected:
 	void generateSamples(int16 *buffer, int length);
+	void applySoundRegister(int r, int v);
 };
 
 } // End of namespace DOSBox
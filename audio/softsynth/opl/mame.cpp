@@ -69,7 +69,10 @@ void OPL::reset() {
 }
 
 void OPL::write(int a, int v) {
-	MAME::OPLWrite(_opl, a, v);
+	if (a & 1)
+		writeReg(_opl->address, v);
+	else
+		MAME::OPLWrite(_opl, a, v);
 }
 
 byte OPL::read(int a) {
@@ -77,6 +80,15 @@ byte OPL::read(int a) {
 }
 
 void OPL::writeReg(int r, int v) {
+	// The timer registers change the status read back, so they cannot
+	// wait in the queue
+	if (r >= 0x02 && r <= 0x04)
+		MAME::OPLWriteReg(_opl, r, v);
+	else
+		writeSoundRegister(r, v);
+}
+
+void OPL::applySoundRegister(int r, int v) {
 	MAME::OPLWriteReg(_opl, r, v);
 }
 
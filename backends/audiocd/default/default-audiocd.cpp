@@ -21,9 +21,11 @@
  */
 
 #include "backends/audiocd/default/default-audiocd.h"
+#include "audio/aheadbuffer.h"
 #include "audio/audiostream.h"
 #include "common/config-manager.h"
 #include "common/system.h"
+#include "common/timer.h"
 
 DefaultAudioCDManager::DefaultAudioCDManager() {
 	_cd.playing = false;
@@ -35,6 +37,7 @@ DefaultAudioCDManager::DefaultAudioCDManager() {
 	_cd.balance = 0;
 	_mixer = g_system->getMixer();
 	_emulating = false;
+	_decodeAheadStream = 0;
 	assert(_mixer);
 }
 
@@ -84,8 +87,18 @@ bool DefaultAudioCDManager::play(int track, int numLoops, int startFrame, int du
 			repetitions. Finally, -1 means infinitely many
 			*/
 			_emulating = true;
-			_mixer->playStream(Audio::Mixer::kMusicSoundType, &_handle,
-			                        Audio::makeLoopingAudioStream(stream, start, end, (numLoops < 1) ? numLoops + 1 : numLoops), -1, _cd.volume, _cd.balance);
+			Audio::AudioStream *loopStream = Audio::makeLoopingAudioStream(stream, start, end, (numLoops < 1) ? numLoops + 1 : numLoops);
+
+			// Optionally decode compressed tracks ahead of playback, outside
+			// of the mixer callback. The looping is done behind the decoder,
+			// so rewinding does not throw the decoded samples away.
+			if (ConfMan.hasKey("cd_decode_ahead") && ConfMan.getInt("cd_decode_ahead") > 0) {
+				_decodeAheadStream = new Audio::DecodeAheadAudioStream(loopStream, ConfMan.getInt("cd_decode_ahead"));
+				g_system->getTimerManager()->installTimerProc(&decodeAheadProc, 10000, this, "DefaultAudioCDManager");
+				_mixer->playStream(Audio::Mixer::kMusicSoundType, &_handle, _decodeAheadStream, -1, _cd.volume, _cd.balance, DisposeAfterUse::NO);
+			} else {
+				_mixer->playStream(Audio::Mixer::kMusicSoundType, &_handle, loopStream, -1, _cd.volume, _cd.balance);
+			}
 			return true;
 		}
 	}
@@ -99,6 +112,18 @@ void DefaultAudioCDManager::stop() {
 		_mixer->stopHandle(_handle);
 		_emulating = false;
 	}
+
+	if (_decodeAheadStream) {
+		// The mixer has let go of the stream, so once the timer callback is
+		// gone as well, nothing uses it anymore
+		g_system->getTimerManager()->removeTimerProc(&decodeAheadProc);
+		delete _decodeAheadStream;
+		_decodeAheadStream = 0;
+	}
+}
+
+void DefaultAudioCDManager::decodeAheadProc(void *refCon) {
+	((DefaultAudioCDManager *)refCon)->_decodeAheadStream->decodeAhead();
 }
 
 bool DefaultAudioCDManager::isPlaying() const {
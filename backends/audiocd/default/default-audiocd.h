@@ -30,6 +30,10 @@ namespace Common {
 class String;
 } // End of namespace Common
 
+namespace Audio {
+class DecodeAheadAudioStream;
+} // End of namespace Audio
+
 /**
  * The default audio cd manager. Implements emulation of audio cd playback.
  */
@@ -71,6 +75,12 @@ protected:
 	Audio::SoundHandle _handle;
 	bool _emulating;
 
+	// Emulated track which is decoded ahead of playback, if enabled. It is
+	// owned here rather than by the mixer, so that the decode-ahead timer
+	// callback is removed before the stream is freed.
+	Audio::DecodeAheadAudioStream *_decodeAheadStream;
+	static void decodeAheadProc(void *refCon);
+
 	Status _cd;
 	Audio::Mixer *_mixer;
 };
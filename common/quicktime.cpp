@@ -28,6 +28,7 @@
 // Seek function by Gael Chardon gael.dev@4now.net
 //
 
+#include "common/bufferedstream.h"
 #include "common/debug.h"
 #include "common/endian.h"
 #include "common/macresman.h"
@@ -39,6 +40,22 @@
 
 namespace Common {
 
+// Size of the read-ahead buffer used on the file handle
+static const uint32 kReadAheadSize = 64 * 1024;
+
+/**
+ * Samples of the different tracks are interleaved in the file, and are
+ * read with a seek and a handful of small reads each. Wrap file handles
+ * which we own into a read-ahead buffer so that playback doesn't hit the
+ * underlying file for every one of these.
+ */
+static SeekableReadStream *wrapReadAhead(SeekableReadStream *stream) {
+	if (dynamic_cast<MemoryReadStream *>(stream))
+		return stream;
+
+	return wrapBufferedSeekableReadStream(stream, kReadAheadSize, DisposeAfterUse::YES);
+}
+
 ////////////////////////////////////////////
 // QuickTimeParser
 ////////////////////////////////////////////
@@ -84,7 +101,7 @@ bool QuickTimeParser::parseFile(const String &filename) {
 		delete _fd;
 	}
 
-	_fd = _resFork->getDataFork();
+	_fd = wrapReadAhead(_resFork->getDataFork());
 	atom.size = _fd->size();
 
 	if (readDefault(atom) < 0 || !_foundMOOV)
@@ -95,7 +112,8 @@ bool QuickTimeParser::parseFile(const String &filename) {
 }
 
 bool QuickTimeParser::parseStream(SeekableReadStream *stream, DisposeAfterUse::Flag disposeFileHandle) {
-	_fd = stream;
+	// Only buffer streams we own; the caller may still use the others
+	_fd = (disposeFileHandle == DisposeAfterUse::YES) ? wrapReadAhead(stream) : stream;
 	_foundMOOV = false;
 	_disposeFileHandle = disposeFileHandle;
 
@@ -470,6 +470,9 @@ bool ROQPlayer::processBlockStill(ROQBlockHeader &blockHeader) {
 	debugC(5, kDebugVideo, "Groovie::ROQ: Processing still (JPEG) block");
 
 	Image::JPEGDecoder jpg;
+	// Have the scanlines converted while decoding
+	if (_vm->_pixelFormat.bytesPerPixel == 2 || _vm->_pixelFormat.bytesPerPixel == 4)
+		jpg.setOutputPixelFormat(_vm->_pixelFormat);
 
 	uint32 startPos = _file->pos();
 	Common::SeekableSubReadStream subStream(_file, startPos, startPos + blockHeader.size, DisposeAfterUse::NO);
@@ -478,7 +481,12 @@ bool ROQPlayer::processBlockStill(ROQBlockHeader &blockHeader) {
 	const Graphics::Surface *srcSurf = jpg.getSurface();
 	_currBuf->free();
 	delete _currBuf;
-	_currBuf = srcSurf->convertTo(_vm->_pixelFormat);
+	if (srcSurf->format == _vm->_pixelFormat) {
+		_currBuf = new Graphics::Surface();
+		_currBuf->copyFrom(*srcSurf);
+	} else {
+		_currBuf = srcSurf->convertTo(_vm->_pixelFormat);
+	}
 
 	_file->seek(startPos + blockHeader.size);
 	return true;
@@ -50,6 +50,8 @@
 
 #include "sci/parser/vocabulary.h"
 
+#include "audio/audiocache.h"
+
 #include "video/avi_decoder.h"
 #include "sci/video/seq_decoder.h"
 #ifdef ENABLE_SCI32
@@ -145,6 +147,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("pi",                 WRAP_METHOD(Console, cmdPlaneItemList));	// alias
 	registerCmd("visible_plane_items", WRAP_METHOD(Console, cmdVisiblePlaneItemList));
 	registerCmd("vpi",                WRAP_METHOD(Console, cmdVisiblePlaneItemList));	// alias
+	registerCmd("frame_stats",        WRAP_METHOD(Console, cmdFrameStats));
 	registerCmd("saved_bits",         WRAP_METHOD(Console, cmdSavedBits));
 	registerCmd("show_saved_bits",    WRAP_METHOD(Console, cmdShowSavedBits));
 	// Segments
@@ -156,6 +159,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("segkill",			WRAP_METHOD(Console, cmdKillSegment));			// alias
 	// Garbage collection
 	registerCmd("gc",					WRAP_METHOD(Console, cmdGCInvoke));
+	registerCmd("gc_stats",			WRAP_METHOD(Console, cmdGCStats));
 	registerCmd("gc_objects",			WRAP_METHOD(Console, cmdGCObjects));
 	registerCmd("gc_reachable",		WRAP_METHOD(Console, cmdGCShowReachable));
 	registerCmd("gc_freeable",		WRAP_METHOD(Console, cmdGCShowFreeable));
@@ -172,6 +176,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("show_instruments",	WRAP_METHOD(Console, cmdShowInstruments));
 	registerCmd("map_instrument",		WRAP_METHOD(Console, cmdMapInstrument));
 	registerCmd("audio_list",		WRAP_METHOD(Console, cmdAudioList));
+	registerCmd("audio_cache",		WRAP_METHOD(Console, cmdAudioCache));
 	// Script
 	registerCmd("addresses",			WRAP_METHOD(Console, cmdAddresses));
 	registerCmd("registers",			WRAP_METHOD(Console, cmdRegisters));
@@ -221,6 +226,8 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("bpe",				WRAP_METHOD(Console, cmdBreakpointFunction));		// alias
 	// VM
 	registerCmd("script_steps",		WRAP_METHOD(Console, cmdScriptSteps));
+	registerCmd("opcode_profile",		WRAP_METHOD(Console, cmdOpcodeProfile));
+	registerCmd("selector_cache",		WRAP_METHOD(Console, cmdSelectorCache));
 	registerCmd("script_objects",   WRAP_METHOD(Console, cmdScriptObjects));
 	registerCmd("scro",             WRAP_METHOD(Console, cmdScriptObjects));
 	registerCmd("script_strings",   WRAP_METHOD(Console, cmdScriptStrings));
@@ -397,6 +404,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" visible_plane_list / vpl - Shows a list of all the planes in the visible draw list (SCI2+)\n");
 	debugPrintf(" plane_items / pi - Shows a list of all items for a plane (SCI2+)\n");
 	debugPrintf(" visible_plane_items / vpi - Shows a list of all items for a plane in the visible draw list (SCI2+)\n");
+	debugPrintf(" frame_stats - Shows frame rendering time statistics, or resets them (SCI2+)\n");
 	debugPrintf(" saved_bits - List saved bits on the hunk\n");
 	debugPrintf(" show_saved_bits - Display saved bits\n");
 	debugPrintf("\n");
@@ -407,6 +415,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf("\n");
 	debugPrintf("Garbage collection:\n");
 	debugPrintf(" gc - Invokes the garbage collector\n");
+	debugPrintf(" gc_stats - Shows garbage collector statistics\n");
 	debugPrintf(" gc_objects - Lists all reachable objects, normalized\n");
 	debugPrintf(" gc_reachable - Lists all addresses directly reachable from a given memory object\n");
 	debugPrintf(" gc_freeable - Lists all addresses freeable in a given segment\n");
@@ -424,6 +433,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" show_instruments - Shows the instruments of a specific song, or all songs\n");
 	debugPrintf(" map_instrument - Dynamically maps an MT-32 instrument to a GM instrument\n");
 	debugPrintf(" audio_list - Lists currently active digital audio samples (SCI2+)\n");
+	debugPrintf(" audio_cache - Shows decoded audio cache statistics, or clears the cache\n");
 	debugPrintf("\n");
 	debugPrintf("Script:\n");
 	debugPrintf(" addresses - Provides information on how to pass addresses\n");
@@ -455,6 +465,8 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf("\n");
 	debugPrintf("VM:\n");
 	debugPrintf(" script_steps - Shows the number of executed SCI operations\n");
+	debugPrintf(" opcode_profile - Shows how often each SCI opcode was executed\n");
+	debugPrintf(" selector_cache - Shows selector lookup cache statistics, or clears the cache\n");
 	debugPrintf(" vm_varlist / vmvarlist / vl - Shows the addresses of variables in the VM\n");
 	debugPrintf(" vm_vars / vmvars / vv - Displays or changes variables in the VM\n");
 	debugPrintf(" stack - Lists the specified number of stack elements\n");
@@ -1343,6 +1355,31 @@ bool Console::cmdAudioList(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdAudioCache(int argc, const char **argv) {
+	if (argc > 2 || (argc == 2 && strcmp(argv[1], "clear"))) {
+		debugPrintf("Shows statistics of the decoded audio cache\n");
+		debugPrintf("Usage: %s [clear]\n", argv[0]);
+		return true;
+	}
+
+	if (argc == 2) {
+		DecodedAudioCacheMan.clear();
+		debugPrintf("Decoded audio cache cleared\n");
+		return true;
+	}
+
+	const uint32 hits = DecodedAudioCacheMan.getHits();
+	const uint32 misses = DecodedAudioCacheMan.getMisses();
+
+	debugPrintf("Decoded audio cache: %d entries, %d of %d KB used\n",
+	            DecodedAudioCacheMan.getEntryCount(),
+	            DecodedAudioCacheMan.getUsedSize() / 1024,
+	            DecodedAudioCacheMan.getMaxSize() / 1024);
+	debugPrintf("%d hits, %d misses\n", hits, misses);
+
+	return true;
+}
+
 bool Console::cmdSaveGame(int argc, const char **argv) {
 	if (argc != 2) {
 		debugPrintf("Saves the current game state to the hard disk\n");
@@ -1861,6 +1898,23 @@ bool Console::cmdVisiblePlaneList(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdFrameStats(int argc, const char **argv) {
+#ifdef ENABLE_SCI32
+	if (_engine->_gfxFrameout) {
+		if (argc == 2 && !scumm_stricmp(argv[1], "reset")) {
+			_engine->_gfxFrameout->resetFrameOutStatistics();
+			debugPrintf("Frame statistics reset\n");
+		} else {
+			_engine->_gfxFrameout->printFrameOutStatistics(this);
+		}
+	} else {
+		debugPrintf("This SCI version does not use frameOut\n");
+	}
+#else
+	debugPrintf("SCI32 isn't included in this compiled executable\n");
+#endif
+	return true;
+}
 
 bool Console::cmdPlaneItemList(int argc, const char **argv) {
 	if (argc != 2) {
@@ -2498,6 +2552,15 @@ bool Console::cmdGCInvoke(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdGCStats(int argc, const char **argv) {
+	const GCStatistics &stats = _engine->_gamestate->gcStats;
+
+	debugPrintf("Garbage collections: %d (%d periodic ones skipped, as nothing was allocated)\n", stats.runs, stats.skipped);
+	debugPrintf("Objects freed: %d\n", stats.freed);
+	debugPrintf("Pause time: last %d ms, longest %d ms, total %d ms\n", stats.lastPause, stats.maxPause, stats.totalPause);
+	return true;
+}
+
 bool Console::cmdGCObjects(int argc, const char **argv) {
 	AddrSet *use_map = findAllActiveReferences(_engine->_gamestate);
 
@@ -3083,6 +3146,75 @@ bool Console::cmdScriptSteps(int argc, const char **argv) {
 	return true;
 }
 
+static int compareOpcodeCounts(const void *a, const void *b) {
+	const uint32 *countA = *(const uint32 * const *)a;
+	const uint32 *countB = *(const uint32 * const *)b;
+
+	if (*countA != *countB)
+		return *countA > *countB ? -1 : 1;
+	return countA < countB ? -1 : 1;
+}
+
+bool Console::cmdOpcodeProfile(int argc, const char **argv) {
+	uint32 *counts = _engine->_gamestate->opcodeCounts;
+
+	if (argc > 2 || (argc == 2 && strcmp(argv[1], "reset"))) {
+		debugPrintf("Shows how often each SCI opcode was executed, most frequent first\n");
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	if (argc == 2) {
+		memset(counts, 0, sizeof(_engine->_gamestate->opcodeCounts));
+		debugPrintf("Opcode profile reset\n");
+		return true;
+	}
+
+	const uint32 *sorted[ARRAYSIZE(_engine->_gamestate->opcodeCounts)];
+	uint64 total = 0;
+	for (uint i = 0; i < ARRAYSIZE(sorted); ++i) {
+		sorted[i] = &counts[i];
+		total += counts[i];
+	}
+
+	qsort(sorted, ARRAYSIZE(sorted), sizeof(sorted[0]), compareOpcodeCounts);
+
+	for (uint i = 0; i < ARRAYSIZE(sorted) && *sorted[i]; ++i) {
+		const uint opcode = sorted[i] - counts;
+		debugPrintf("%02x %-8s %10d  %5.2f%%\n", opcode, opcodeNames[opcode], *sorted[i], *sorted[i] * 100.0 / total);
+	}
+
+	return true;
+}
+
+bool Console::cmdSelectorCache(int argc, const char **argv) {
+	SegManager *segMan = _engine->_gamestate->_segMan;
+
+	if (argc > 2 || (argc == 2 && strcmp(argv[1], "clear"))) {
+		debugPrintf("Shows statistics of the selector lookup cache\n");
+		debugPrintf("Usage: %s [clear]\n", argv[0]);
+		return true;
+	}
+
+	if (argc == 2) {
+		segMan->clearSelectorCache();
+		segMan->resetSelectorCacheStats();
+		debugPrintf("Selector lookup cache cleared\n");
+		return true;
+	}
+
+	const uint32 hits = segMan->getSelectorCacheHits();
+	const uint32 misses = segMan->getSelectorCacheMisses();
+
+	debugPrintf("Selector lookup cache: %d entries\n", segMan->getSelectorCacheSize());
+	debugPrintf("%d hits, %d misses", hits, misses);
+	if (hits + misses)
+		debugPrintf(" (%d%% hit rate)", (int)((uint64)hits * 100 / (hits + misses)));
+	debugPrintf("\n");
+
+	return true;
+}
+
 bool Console::cmdScriptObjects(int argc, const char **argv) {
 	int curScriptNr = -1;
 
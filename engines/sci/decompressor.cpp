@@ -53,11 +53,16 @@ void Decompressor::init(Common::ReadStream *src, byte *dest, uint32 nPacked,
 	_nBits = 0;
 	_dwRead = _dwWrote = 0;
 	_dwBits = 0;
+
+	delete[] _srcData;
+	_srcData = new byte[nPacked];
+	_srcSize = src->read(_srcData, nPacked);
+	_srcPos = 0;
 }
 
 void Decompressor::fetchBitsMSB() {
 	while (_nBits <= 24) {
-		_dwBits |= ((uint32)_src->readByte()) << (24 - _nBits);
+		_dwBits |= ((uint32)readSrcByte()) << (24 - _nBits);
 		_nBits += 8;
 		_dwRead++;
 	}
@@ -79,7 +84,7 @@ byte Decompressor::getByteMSB() {
 
 void Decompressor::fetchBitsLSB() {
 	while (_nBits <= 24) {
-		_dwBits |= ((uint32)_src->readByte()) << _nBits;
+		_dwBits |= ((uint32)readSrcByte()) << _nBits;
 		_nBits += 8;
 		_dwRead++;
 	}
@@ -99,9 +104,6 @@ byte Decompressor::getByteLSB() {
 	return getBitsLSB(8);
 }
 
-void Decompressor::putByte(byte b) {
-	_dest[_dwWrote++] = b;
-}
 //-------------------------------
 //  Huffman decompressor
 //-------------------------------
@@ -112,10 +114,11 @@ int DecompressorHuffman::unpack(Common::ReadStream *src, byte *dest, uint32 nPac
 	int16 c;
 	uint16 terminator;
 
-	numnodes = _src->readByte();
-	terminator = _src->readByte() | 0x100;
+	numnodes = readSrcByte();
+	terminator = readSrcByte() | 0x100;
 	_nodes = new byte [numnodes << 1];
-	_src->read(_nodes, numnodes << 1);
+	for (int i = 0; i < numnodes << 1; i++)
+		_nodes[i] = readSrcByte();
 
 	while ((c = getc2()) != terminator && (c >= 0) && !isFinished())
 		putByte(c);
@@ -217,15 +220,21 @@ int DecompressorLZW::unpackLZW(Common::ReadStream *src, byte *dest, uint32 nPack
 					return SCI_ERROR_DECOMPRESSION_ERROR;
 				}
 				tokenlastlength = tokenlengthlist[token] + 1;
+				uint32 copyLength = tokenlastlength;
 				if (_dwWrote + tokenlastlength > _szUnpacked) {
 					// For me this seems a normal situation, It's necessary to handle it
 					warning("unpackLZW: Trying to write beyond the end of array(len=%d, destctr=%d, tok_len=%d)",
 					        _szUnpacked, _dwWrote, tokenlastlength);
-					for (int i = 0; _dwWrote < _szUnpacked; i++)
-						putByte(dest[tokenlist[token] + i]);
-				} else
-					for (int i = 0; i < tokenlastlength; i++)
-						putByte(dest[tokenlist[token] + i]);
+					copyLength = _szUnpacked - _dwWrote;
+				}
+
+				// The token may end in the bytes being written, so this
+				// has to go byte by byte
+				const byte *copySrc = dest + tokenlist[token];
+				byte *copyDest = dest + _dwWrote;
+				for (uint32 i = 0; i < copyLength; i++)
+					copyDest[i] = copySrc[i];
+				_dwWrote += copyLength;
 			} else {
 				tokenlastlength = 1;
 				if (_dwWrote >= _szUnpacked)
@@ -416,7 +425,7 @@ void DecompressorLZW::reorderPic(byte *src, byte *dest, int dsize) {
 	byte *seeker = src;
 	byte *writer = dest;
 	char viewdata[7];
-	byte *cdata, *cdata_start;
+	byte *cdata;
 
 	*writer++ = PIC_OP_OPX;
 	*writer++ = PIC_OPX_SET_PALETTE;
@@ -453,8 +462,9 @@ void DecompressorLZW::reorderPic(byte *src, byte *dest, int dsize) {
 		seeker += dsize - view_size - view_start - EXTRA_MAGIC_SIZE;
 	}
 
-	cdata_start = cdata = (byte *)malloc(cdata_size);
-	memcpy(cdata, seeker, cdata_size);
+	// The source buffer is left untouched, so the cel data can be decoded
+	// from where it is
+	cdata = seeker;
 	seeker += cdata_size;
 
 	writer = dest + view_start;
@@ -472,8 +482,6 @@ void DecompressorLZW::reorderPic(byte *src, byte *dest, int dsize) {
 	*writer++ = 0;
 
 	decodeRLE(&seeker, &cdata, writer, view_size);
-
-	free(cdata_start);
 }
 
 void DecompressorLZW::buildCelHeaders(byte **seeker, byte **writer, int celindex, int *cc_lengths, int max) {
@@ -700,10 +708,23 @@ uint32 DecompressorLZS::getCompLen() {
 }
 
 void DecompressorLZS::copyComp(int offs, uint32 clen) {
-	int hpos = _dwWrote - offs;
-
-	while (clen--)
-		putByte(_dest[hpos++]);
+	if (offs > (int)_dwWrote) {
+		warning("lzsDecomp: offset %d before the start of the data", offs);
+		offs = _dwWrote;
+	}
+	clen = MIN(clen, _szUnpacked - _dwWrote);
+
+	const byte *src = _dest + _dwWrote - offs;
+	byte *dest = _dest + _dwWrote;
+	_dwWrote += clen;
+
+	if ((uint32)offs >= clen) {
+		memcpy(dest, src, clen);
+	} else {
+		// Overlapping copy, repeating the last offs bytes
+		while (clen--)
+			*dest++ = *src++;
+	}
 }
 
 #endif	// #ifdef ENABLE_SCI32
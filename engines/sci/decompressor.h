@@ -51,15 +51,17 @@ enum ResourceCompression {
  */
 class Decompressor {
 public:
-	Decompressor() {}
-	virtual ~Decompressor() {}
+	Decompressor() : _srcData(nullptr), _srcSize(0), _srcPos(0) {}
+	virtual ~Decompressor() { delete[] _srcData; }
 
 
 	virtual int unpack(Common::ReadStream *src, byte *dest, uint32 nPacked, uint32 nUnpacked);
 
 protected:
 	/**
-	 * Initialize decompressor.
+	 * Initialize decompressor. This reads all the packed data from src into
+	 * memory, so that the bit readers do not have to go through the stream
+	 * for every byte.
 	 * @param src		source stream to read from
 	 * @param dest		destination stream to write to
 	 * @param nPacked	size of packed data
@@ -94,12 +96,21 @@ protected:
 	void fetchBitsMSB();
 	void fetchBitsLSB();
 
+	/**
+	 * Get the next byte of the packed data, bypassing the bit buffer.
+	 * Reading beyond the end of the packed data returns 0.
+	 */
+	byte readSrcByte() {
+		return _srcPos < _srcSize ? _srcData[_srcPos++] : 0;
+	}
+
 	/**
 	 * Write one byte into _dest stream
 	 * @param b byte to put
 	 */
-
-	virtual void putByte(byte b);
+	void putByte(byte b) {
+		_dest[_dwWrote++] = b;
+	}
 
 	/**
 	 * Returns true if all expected data has been unpacked to _dest
@@ -116,6 +127,9 @@ protected:
 	uint32 _dwRead;		///< number of bytes read from _src
 	uint32 _dwWrote;	///< number of bytes written to _dest
 	Common::ReadStream *_src;
+	byte *_srcData;		///< packed data, as read from _src
+	uint32 _srcSize;	///< number of bytes in _srcData
+	uint32 _srcPos;		///< read position in _srcData
 	byte *_dest;
 };
 
@@ -22,6 +22,7 @@
 
 #include "sci/engine/gc.h"
 #include "common/array.h"
+#include "common/system.h"
 #include "sci/graphics/ports.h"
 
 #ifdef ENABLE_SCI32
@@ -182,6 +183,8 @@ AddrSet *findAllActiveReferences(EngineState *s) {
 void run_gc(EngineState *s) {
 	SegManager *segMan = s->_segMan;
 
+	const uint32 startTime = g_system->getMillis();
+
 	// Some debug stuff
 	debugC(kDebugLevelGC, "[GC] Running...");
 #ifdef GC_DEBUG_CODE
@@ -214,6 +217,7 @@ void run_gc(EngineState *s) {
 				if (!activeRefs->contains(addr)) {
 					// Not found -> we can free it
 					mobj->freeAtAddress(segMan, addr);
+					s->gcStats.freed++;
 					debugC(kDebugLevelGC, "[GC] Deallocating %04x:%04x", PRINT_REG(addr));
 #ifdef GC_DEBUG_CODE
 					segcount[type]++;
@@ -226,6 +230,14 @@ void run_gc(EngineState *s) {
 
 	delete activeRefs;
 
+	segMan->resetAllocationsSinceGC();
+
+	GCStatistics &stats = s->gcStats;
+	stats.runs++;
+	stats.lastPause = g_system->getMillis() - startTime;
+	stats.maxPause = MAX(stats.maxPause, stats.lastPause);
+	stats.totalPause += stats.lastPause;
+
 #ifdef GC_DEBUG_CODE
 	// Output debug summary of garbage collection
 	debugC(kDebugLevelGC, "[GC] Summary:");
@@ -235,4 +247,13 @@ void run_gc(EngineState *s) {
 #endif
 }
 
+void run_gc_if_needed(EngineState *s) {
+	if (!s->_segMan->needsGarbageCollection()) {
+		s->gcStats.skipped++;
+		return;
+	}
+
+	run_gc(s);
+}
+
 } // End of namespace Sci
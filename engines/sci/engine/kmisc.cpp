@@ -358,6 +358,10 @@ reg_t kMemory(EngineState *s, int argc, reg_t *argv) {
 				return s->r_acc;
 			}
 			WRITE_SCIENDIAN_UINT16(ref.raw, argv[2].getOffset());		// Amiga versions are BE
+
+			// Scripts may be poked into; make sure the VM sees the change
+			if (s->_segMan->getSegmentType(argv[1].getSegment()) == SEG_TYPE_SCRIPT)
+				s->_segMan->getScript(argv[1].getSegment())->invalidateDecodedCode();
 		} else {
 			if (ref.skipByte)
 				error("Attempt to poke memory at odd offset %04X:%04X", PRINT_REG(argv[1]));
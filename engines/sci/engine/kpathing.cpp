@@ -111,10 +111,16 @@ struct Vertex {
 	// Previous vertex in shortest path
 	Vertex *path_prev;
 
+	// A* set membership
+	bool inOpenSet;
+	bool inClosedSet;
+
 public:
 	Vertex(const Common::Point &p) : v(p) {
 		costG = HUGE_DISTANCE;
 		path_prev = NULL;
+		inOpenSet = false;
+		inClosedSet = false;
 	}
 };
 
@@ -675,11 +681,29 @@ static VertexList *visible_vertices(PathfindingState *s, Vertex *vertex_cur) {
 		if ((vertex == vertex_cur) || (inside(vertex->v, vertex_cur)) || (inside(vertex_cur->v, vertex)))
 			continue;
 
+		// Bounding box of the line of sight. Edges entirely outside of it
+		// can neither contain vertex_cur or vertex, nor properly intersect
+		// the line, so they are skipped before the more expensive tests.
+		// between() assumes distinct end points, so the box is only used
+		// when they are.
+		const bool useBounds = (vertex_cur->v != vertex->v);
+		const int16 minX = MIN(vertex_cur->v.x, vertex->v.x);
+		const int16 maxX = MAX(vertex_cur->v.x, vertex->v.x);
+		const int16 minY = MIN(vertex_cur->v.y, vertex->v.y);
+		const int16 maxY = MAX(vertex_cur->v.y, vertex->v.y);
+
 		// Check for intersecting edges
 		int j;
 		for (j = 0; j < s->vertices; j++) {
 			Vertex *edge = s->vertex_index[j];
 			if (VERTEX_HAS_EDGES(edge)) {
+				if (useBounds) {
+					const Common::Point &p = edge->v;
+					const Common::Point &q = CLIST_NEXT(edge)->v;
+					if (MAX(p.x, q.x) < minX || MIN(p.x, q.x) > maxX || MAX(p.y, q.y) < minY || MIN(p.y, q.y) > maxY)
+						continue;
+				}
+
 				if (between(vertex_cur->v, vertex->v, edge->v)) {
 					// If we hit a vertex, make sure we can pass through it without intersecting its polygon
 					if ((inside(vertex_cur->v, edge)) || (inside(vertex->v, edge)))
@@ -1310,13 +1334,13 @@ static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Co
  * Parameters: (PathfindingState *) s: The pathfinding state
  */
 static void AStar(PathfindingState *s) {
-	// Vertices of which the shortest path is known
-	VertexList closedSet;
-
-	// The remaining vertices
+	// The remaining vertices. Vertices of which the shortest path is known
+	// are marked with inClosedSet instead of being kept in a list, as
+	// membership is checked for every visible vertex.
 	VertexList openSet;
 
 	openSet.push_front(s->vertex_start);
+	s->vertex_start->inOpenSet = true;
 	s->vertex_start->costG = 0;
 	s->vertex_start->costF = (uint32)sqrt((float)s->vertex_start->v.sqrDist(s->vertex_end->v));
 
@@ -1342,7 +1366,8 @@ static void AStar(PathfindingState *s) {
 			break;
 
 		// Move vertex from set open to set closed
-		closedSet.push_front(vertex_min);
+		vertex_min->inClosedSet = true;
+		vertex_min->inOpenSet = false;
 		openSet.erase(vertex_min_it);
 
 		VertexList *visVerts = visible_vertices(s, vertex_min);
@@ -1351,11 +1376,13 @@ static void AStar(PathfindingState *s) {
 			uint32 new_dist;
 			Vertex *vertex = *it;
 
-			if (closedSet.contains(vertex))
+			if (vertex->inClosedSet)
 				continue;
 
-			if (!openSet.contains(vertex))
+			if (!vertex->inOpenSet) {
 				openSet.push_front(vertex);
+				vertex->inOpenSet = true;
+			}
 
 			new_dist = vertex_min->costG + (uint32)sqrt((float)vertex_min->v.sqrDist(vertex->v));
 
@@ -1562,7 +1589,9 @@ reg_t kAvoidPath(EngineState *s, int argc, reg_t *argv) {
 		}
 
 		// Apply Dijkstra
+		const uint32 startTime = g_system->getMillis();
 		AStar(p);
+		debugC(kDebugLevelAvoidPath, "[avoidpath] Searched %d vertices in %d ms", p->vertices, g_system->getMillis() - startTime);
 
 		output = output_path(p, s);
 		delete p;
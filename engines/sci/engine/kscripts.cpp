@@ -46,6 +46,26 @@ reg_t kLoad(EngineState *s, int argc, reg_t *argv) {
 	if (restype == kResourceTypeMemory)
 		return s->_segMan->allocateHunkEntry("kLoad()", resnr);
 
+	// Rooms load their graphics and sounds while they are being set up.
+	// Read and decompress them now, so that they are already cached once
+	// they get used, instead of in the middle of the room's animation.
+	switch (restype) {
+	case kResourceTypeView:
+	case kResourceTypePic:
+	case kResourceTypeSound:
+	case kResourceTypePalette:
+	case kResourceTypeFont:
+	case kResourceTypeCursor: {
+		ResourceManager *resMan = g_sci->getResMan();
+		const ResourceId id(restype, resnr);
+		if (resMan->testResource(id))
+			resMan->findResource(id, false);
+		break;
+	}
+	default:
+		break;
+	}
+
 	return make_reg(0, ((restype << 11) | resnr)); // Return the resource identifier as handle
 }
 
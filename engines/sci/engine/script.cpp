@@ -73,6 +73,31 @@ void Script::freeScript(const bool keepLocalsSegment) {
 	_offsetLookupObjectCount = 0;
 	_offsetLookupStringCount = 0;
 	_offsetLookupSaidCount = 0;
+
+	invalidateDecodedCode();
+}
+
+const DecodedInstruction &Script::decodeInstruction(uint32 offset) {
+	if (_decodedCodeIndex.empty())
+		_decodedCodeIndex.resize(_buf->size());
+
+	if (_decodedCode.size() == 0xFFFF) {
+		DecodedInstruction &instruction = _uncachedInstruction;
+		instruction.size = readPMachineInstruction(getBuf(offset), instruction.extOpcode, instruction.opparams);
+		return instruction;
+	}
+
+	DecodedInstruction instruction;
+	instruction.size = readPMachineInstruction(getBuf(offset), instruction.extOpcode, instruction.opparams);
+
+	_decodedCode.push_back(instruction);
+	_decodedCodeIndex[offset] = _decodedCode.size();
+	return _decodedCode.back();
+}
+
+void Script::invalidateDecodedCode() {
+	_decodedCode.clear();
+	_decodedCodeIndex.clear();
 }
 
 enum {
@@ -102,6 +102,19 @@ private:
 	uint16 _offsetLookupStringCount;
 	uint16 _offsetLookupSaidCount;
 
+	/**
+	 * Instructions which have been executed so far, decoded. The index
+	 * table maps each offset within the script buffer to 1 + the index of
+	 * the instruction starting there, or to 0 if it has not been decoded
+	 * yet. Scripts have far fewer than 65535 instructions; should one have
+	 * more, the rest is decoded into _uncachedInstruction on every use.
+	 */
+	Common::Array<DecodedInstruction> _decodedCode;
+	Common::Array<uint16> _decodedCodeIndex;
+	DecodedInstruction _uncachedInstruction;
+
+	const DecodedInstruction &decodeInstruction(uint32 offset);
+
 public:
 	int getLocalsOffset() const { return _localsOffset; }
 	uint16 getLocalsCount() const { return _localsCount; }
@@ -155,6 +168,24 @@ public:
 	Object *getObject(uint32 offset);
 	const Object *getObject(uint32 offset) const;
 
+	/**
+	 * Returns the decoded instruction at the given offset. Each
+	 * instruction only gets decoded the first time it is requested.
+	 * The returned reference is only valid until the next call.
+	 */
+	inline const DecodedInstruction &getInstruction(uint32 offset) {
+		if (offset < _decodedCodeIndex.size() && _decodedCodeIndex[offset])
+			return _decodedCode[_decodedCodeIndex[offset] - 1];
+
+		return decodeInstruction(offset);
+	}
+
+	/**
+	 * Drops all decoded instructions. Must be called whenever the code
+	 * inside the script buffer gets modified.
+	 */
+	void invalidateDecodedCode();
+
 	/**
 	 * Initializes an object within the segment manager
 	 * @param obj_pos	Location (segment, offset) of the object. It must
@@ -43,6 +43,11 @@ SegManager::SegManager(ResourceManager *resMan, ScriptPatcher *scriptPatcher)
 	_saveDirPtr = NULL_REG;
 	_parserPtr = NULL_REG;
 
+	_selectorCacheHits = 0;
+	_selectorCacheMisses = 0;
+
+	_allocationsSinceGC = 1;
+
 #ifdef ENABLE_SCI32
 	_arraysSegId = 0;
 	_bitmapSegId = 0;
@@ -56,6 +61,11 @@ SegManager::~SegManager() {
 }
 
 void SegManager::resetSegMan() {
+	clearSelectorCache();
+
+	// Whatever gets restored next has not been collected yet
+	_allocationsSinceGC = 1;
+
 	// Free memory
 	for (uint i = 0; i < _heap.size(); i++) {
 		if (_heap[i])
@@ -167,6 +177,7 @@ void SegManager::deallocate(SegmentId seg) {
 	if (mobj->getType() == SEG_TYPE_SCRIPT) {
 		Script *scr = (Script *)mobj;
 		_scriptSegMap.erase(scr->getScriptNumber());
+		clearSelectorCache();
 		if (scr->getLocalsSegment()) {
 			// Check if the locals segment has already been deallocated.
 			// If the locals block has been stored in a segment with an ID
@@ -403,6 +414,7 @@ reg_t SegManager::allocateHunkEntry(const char *hunk_type, int size) {
 	table = (HunkTable *)_heap[_hunksSegId];
 
 	offset = table->allocEntry();
+	++_allocationsSinceGC;
 
 	reg_t addr = make_reg(_hunksSegId, offset);
 	Hunk *h = &table->at(offset);
@@ -438,6 +450,7 @@ Clone *SegManager::allocateClone(reg_t *addr) {
 		table = (CloneTable *)_heap[_clonesSegId];
 
 	offset = table->allocEntry();
+	++_allocationsSinceGC;
 
 	*addr = make_reg(_clonesSegId, offset);
 	return &table->at(offset);
@@ -452,6 +465,7 @@ List *SegManager::allocateList(reg_t *addr) {
 	table = (ListTable *)_heap[_listsSegId];
 
 	offset = table->allocEntry();
+	++_allocationsSinceGC;
 
 	*addr = make_reg(_listsSegId, offset);
 	return &table->at(offset);
@@ -466,6 +480,7 @@ Node *SegManager::allocateNode(reg_t *addr) {
 	table = (NodeTable *)_heap[_nodesSegId];
 
 	offset = table->allocEntry();
+	++_allocationsSinceGC;
 
 	*addr = make_reg(_nodesSegId, offset);
 	return &table->at(offset);
@@ -837,6 +852,7 @@ byte *SegManager::allocDynmem(int size, const char *descr, reg_t *addr) {
 	SegmentId seg;
 	SegmentObj *mobj = allocSegment(new DynMem(), &seg);
 	*addr = make_reg(seg, 0);
+	++_allocationsSinceGC;
 
 	DynMem &d = *(DynMem *)mobj;
 
@@ -879,6 +895,7 @@ SciArray *SegManager::allocateArray(SciArrayType type, uint16 size, reg_t *addr)
 		table = (ArrayTable *)_heap[_arraysSegId];
 
 	offset = table->allocEntry();
+	++_allocationsSinceGC;
 
 	*addr = make_reg(_arraysSegId, offset);
 
@@ -935,6 +952,7 @@ SciBitmap *SegManager::allocateBitmap(reg_t *addr, const int16 width, const int1
 	}
 
 	offset = table->allocEntry();
+	++_allocationsSinceGC;
 
 	*addr = make_reg(_bitmapSegId, offset);
 	SciBitmap &bitmap = table->at(offset);
@@ -1028,6 +1046,8 @@ int SegManager::instantiateScript(int scriptNum) {
 		scr = allocateScript(scriptNum, &segmentId);
 	}
 
+	clearSelectorCache();
+
 	scr->load(scriptNum, _resMan, _scriptPatcher);
 	scr->initializeLocals(this);
 	scr->initializeClasses(this);
@@ -1054,6 +1074,8 @@ void SegManager::uninstantiateScript(int script_nr) {
 	if (scr->getLockers() > 0)
 		return;
 
+	clearSelectorCache();
+
 	// Free all classtable references to this script
 	for (uint i = 0; i < classTableSize(); i++)
 		if (getClass(i).reg.getSegment() == segmentId)
@@ -1066,6 +1088,7 @@ void SegManager::uninstantiateScript(int script_nr) {
 	if (!scr->getLockers()) {
 		// The actual script deletion seems to be done by SCI scripts themselves
 		scr->markDeleted();
+		++_allocationsSinceGC; // Its segment is freed by the garbage collector
 		debugC(kDebugLevelScripts, "Unloaded script 0x%x.", script_nr);
 	}
 }
@@ -46,6 +46,34 @@ enum ScriptLoadType {
 
 class Script;
 
+/**
+ * Result of a selector lookup, as cached by SegManager. Objects which share
+ * the same position (i.e. script objects and their clones) share the same
+ * property layout and methods, so lookups are keyed by that position.
+ */
+struct SelectorLookupKey {
+	reg_t pos;
+	Selector selector;
+
+	bool operator==(const SelectorLookupKey &other) const {
+		return pos == other.pos && selector == other.selector;
+	}
+};
+
+struct SelectorLookupKey_Hash {
+	uint operator()(const SelectorLookupKey &key) const {
+		return ((key.pos.getSegment() << 18) ^ key.pos.getOffset()) * 31 + key.selector;
+	}
+};
+
+struct SelectorLookupEntry {
+	SelectorType type;
+	int varIndex;   ///< Index of the property, if type is kSelectorVariable
+	reg_t funcAddr; ///< Address of the method, if type is kSelectorMethod
+};
+
+typedef Common::HashMap<SelectorLookupKey, SelectorLookupEntry, SelectorLookupKey_Hash> SelectorLookupCache;
+
 class SegManager : public Common::Serializable {
 	friend class Console;
 public:
@@ -456,8 +484,51 @@ public:
 
 	const Common::Array<SegmentObj *> &getSegments() const { return _heap; }
 
+	/**
+	 * Returns true if anything was allocated, or a script unloaded, since
+	 * the last garbage collection. If not, nothing can have been leaked
+	 * that is worth collecting.
+	 */
+	bool needsGarbageCollection() const { return _allocationsSinceGC != 0; }
+	void resetAllocationsSinceGC() { _allocationsSinceGC = 0; }
+
+	/**
+	 * Looks up a selector in the cache used by lookupSelector().
+	 * @return the cached entry, or NULL if the selector is not cached yet
+	 */
+	const SelectorLookupEntry *findCachedSelector(const SelectorLookupKey &key) {
+		SelectorLookupCache::const_iterator it = _selectorLookupCache.find(key);
+		if (it == _selectorLookupCache.end()) {
+			++_selectorCacheMisses;
+			return NULL;
+		}
+
+		++_selectorCacheHits;
+		return &it->_value;
+	}
+
+	void cacheSelector(const SelectorLookupKey &key, const SelectorLookupEntry &entry) {
+		_selectorLookupCache.setVal(key, entry);
+	}
+
+	/**
+	 * Empties the selector cache. This happens whenever a script gets
+	 * loaded or unloaded, as that may change the class hierarchy.
+	 */
+	void clearSelectorCache() { _selectorLookupCache.clear(); }
+
+	uint getSelectorCacheSize() const { return _selectorLookupCache.size(); }
+	uint32 getSelectorCacheHits() const { return _selectorCacheHits; }
+	uint32 getSelectorCacheMisses() const { return _selectorCacheMisses; }
+	void resetSelectorCacheStats() { _selectorCacheHits = _selectorCacheMisses = 0; }
+
 private:
 	Common::Array<SegmentObj *> _heap;
+	SelectorLookupCache _selectorLookupCache;
+	uint32 _selectorCacheHits;
+	uint32 _selectorCacheMisses;
+
+	uint32 _allocationsSinceGC;
 	Common::Array<Class> _classTable; /**< Table of all classes */
 	/** Map script ids to segment ids. */
 	Common::HashMap<int, SegmentId> _scriptSegMap;
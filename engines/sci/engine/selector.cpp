@@ -315,34 +315,53 @@ SelectorType lookupSelector(SegManager *segMan, reg_t obj_location, Selector sel
 		error("lookupSelector: Attempt to send to non-object or invalid script. Address %04x:%04x, %s", PRINT_REG(obj_location), origin.toString().c_str());
 	}
 
-	index = obj->locateVarSelector(segMan, selectorId);
+	// Clones keep the position of the object they were cloned from, and
+	// share its properties and methods
+	SelectorLookupKey key;
+	key.pos = obj->getPos();
+	key.selector = selectorId;
 
-	if (index >= 0) {
-		// Found it as a variable
-		if (varp) {
-			varp->obj = obj_location;
-			varp->varindex = index;
-		}
-		return kSelectorVariable;
+	const SelectorLookupEntry *cached = segMan->findCachedSelector(key);
+	SelectorLookupEntry entry;
+
+	if (cached) {
+		entry = *cached;
 	} else {
-		// Check if it's a method, with recursive lookup in superclasses
-		while (obj) {
-			index = obj->funcSelectorPosition(selectorId);
-			if (index >= 0) {
-				if (fptr)
-					*fptr = obj->getFunction(index);
-
-				return kSelectorMethod;
-			} else {
-				obj = segMan->getObject(obj->getSuperClassSelector());
+		entry.type = kSelectorNone;
+		entry.varIndex = obj->locateVarSelector(segMan, selectorId);
+		entry.funcAddr = NULL_REG;
+
+		if (entry.varIndex >= 0) {
+			// Found it as a variable
+			entry.type = kSelectorVariable;
+		} else {
+			// Check if it's a method, with recursive lookup in superclasses
+			while (obj) {
+				index = obj->funcSelectorPosition(selectorId);
+				if (index >= 0) {
+					entry.type = kSelectorMethod;
+					entry.funcAddr = obj->getFunction(index);
+					break;
+				} else {
+					obj = segMan->getObject(obj->getSuperClassSelector());
+				}
 			}
 		}
 
-		return kSelectorNone;
+		segMan->cacheSelector(key, entry);
 	}
 
+	if (entry.type == kSelectorVariable) {
+		if (varp) {
+			varp->obj = obj_location;
+			varp->varindex = entry.varIndex;
+		}
+	} else if (entry.type == kSelectorMethod) {
+		if (fptr)
+			*fptr = entry.funcAddr;
+	}
 
-//	return _lookupSelector_function(segMan, obj, selectorId, fptr);
+	return entry.type;
 }
 
 } // End of namespace Sci
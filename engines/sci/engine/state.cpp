@@ -100,6 +100,7 @@ void EngineState::reset(bool isRestoring) {
 	lastWaitTime = 0;
 
 	gcCountDown = 0;
+	gcStats.reset();
 
 #ifdef ENABLE_SCI32
 	_eventCounter = 0;
@@ -116,6 +117,7 @@ void EngineState::reset(bool isRestoring) {
 	_cursorWorkaroundActive = false;
 
 	scriptStepCounter = 0;
+	memset(opcodeCounts, 0, sizeof(opcodeCounts));
 	scriptGCInterval = GC_INTERVAL;
 
 	_videoState.reset();
@@ -95,6 +95,24 @@ struct VideoState {
 	}
 };
 
+/**
+ * Statistics of the garbage collector, as shown by the gc_stats console
+ * command.
+ */
+struct GCStatistics {
+	uint32 runs;       ///< Number of collections
+	uint32 skipped;    ///< Number of periodic collections skipped, as there was nothing new to collect
+	uint32 freed;      ///< Number of objects freed
+	uint32 lastPause;  ///< Duration of the last collection, in milliseconds
+	uint32 maxPause;   ///< Duration of the longest collection, in milliseconds
+	uint32 totalPause; ///< Duration of all collections, in milliseconds
+
+	void reset() {
+		runs = skipped = freed = 0;
+		lastPause = maxPause = totalPause = 0;
+	}
+};
+
 /**
  * Trace information about a VM function call.
  */
@@ -184,6 +202,7 @@ public:
 	int16 gameIsRestarting; // is set when restarting (=1) or restoring the game (=2)
 
 	int scriptStepCounter; // Counts the number of steps executed
+	uint32 opcodeCounts[128]; // Counts the number of times each opcode was executed
 	int scriptGCInterval; // Number of steps in between gcs
 
 	uint16 currentRoomNumber() const;
@@ -201,6 +220,7 @@ public:
 	void shrinkStackToBase();
 
 	int gcCountDown; /**< Number of kernel calls until next gc */
+	GCStatistics gcStats;
 
 	MessageState *_msgState;
 
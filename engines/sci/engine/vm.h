@@ -408,6 +408,17 @@ SelectorType lookupSelector(SegManager *segMan, reg_t obj, Selector selectorid,
  */
 int readPMachineInstruction(const byte *src, byte &extOpcode, int16 opparams[4]);
 
+/**
+ * A PMachine instruction, as decoded by readPMachineInstruction(). Scripts
+ * keep these around, so that the VM only has to decode each instruction
+ * once.
+ */
+struct DecodedInstruction {
+	int16 opparams[4];
+	uint16 size;     ///< Number of bytes the instruction takes up in the script
+	byte extOpcode;
+};
+
 /**
  * Finds the script-absolute offset of a relative object offset.
  *
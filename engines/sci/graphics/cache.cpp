@@ -35,7 +35,7 @@
 namespace Sci {
 
 GfxCache::GfxCache(ResourceManager *resMan, GfxScreen *screen, GfxPalette *palette)
-	: _resMan(resMan), _screen(screen), _palette(palette) {
+	: _resMan(resMan), _screen(screen), _palette(palette), _viewUseCounter(0) {
 }
 
 GfxCache::~GfxCache() {
@@ -54,13 +54,31 @@ void GfxCache::purgeFontCache() {
 
 void GfxCache::purgeViewCache() {
 	for (ViewCache::iterator iter = _cachedViews.begin(); iter != _cachedViews.end(); ++iter) {
-		delete iter->_value;
-		iter->_value = 0;
+		delete iter->_value.view;
+		iter->_value.view = 0;
 	}
 
 	_cachedViews.clear();
 }
 
+void GfxCache::trimViewCache() {
+	uint32 memoryUsage = 0;
+	for (ViewCache::const_iterator iter = _cachedViews.begin(); iter != _cachedViews.end(); ++iter)
+		memoryUsage += iter->_value.view->getMemoryUsage();
+
+	while (!_cachedViews.empty() && (_cachedViews.size() >= MAX_CACHED_VIEWS || memoryUsage > MAX_CACHED_VIEWS_MEMORY)) {
+		ViewCache::iterator oldest = _cachedViews.begin();
+		for (ViewCache::iterator iter = _cachedViews.begin(); iter != _cachedViews.end(); ++iter) {
+			if (iter->_value.lastUse < oldest->_value.lastUse)
+				oldest = iter;
+		}
+
+		memoryUsage -= oldest->_value.view->getMemoryUsage();
+		delete oldest->_value.view;
+		_cachedViews.erase(oldest);
+	}
+}
+
 GfxFont *GfxCache::getFont(GuiResourceId fontId) {
 	if (_cachedFonts.size() >= MAX_CACHED_FONTS)
 		purgeFontCache();
@@ -77,13 +95,21 @@ GfxFont *GfxCache::getFont(GuiResourceId fontId) {
 }
 
 GfxView *GfxCache::getView(GuiResourceId viewId) {
-	if (_cachedViews.size() >= MAX_CACHED_VIEWS)
-		purgeViewCache();
+	ViewCache::iterator iter = _cachedViews.find(viewId);
+	if (iter != _cachedViews.end()) {
+		iter->_value.lastUse = ++_viewUseCounter;
+		return iter->_value.view;
+	}
 
-	if (!_cachedViews.contains(viewId))
-		_cachedViews[viewId] = new GfxView(_resMan, _screen, _palette, viewId);
+	// Only throw out the views which have not been used for the longest
+	// time, instead of the whole cache, so that the views of the current
+	// room do not need to be decoded again
+	trimViewCache();
 
-	return _cachedViews[viewId];
+	CachedView &cachedView = _cachedViews[viewId];
+	cachedView.view = new GfxView(_resMan, _screen, _palette, viewId);
+	cachedView.lastUse = ++_viewUseCounter;
+	return cachedView.view;
 }
 
 int16 GfxCache::kernelViewGetCelWidth(GuiResourceId viewId, int16 loopNo, int16 celNo) {
@@ -30,8 +30,13 @@ namespace Sci {
 class GfxFont;
 class GfxView;
 
+struct CachedView {
+	GfxView *view;
+	uint32 lastUse; ///< Value of GfxCache::_viewUseCounter when last requested
+};
+
 typedef Common::HashMap<int, GfxFont *> FontCache;
-typedef Common::HashMap<int, GfxView *> ViewCache;
+typedef Common::HashMap<int, CachedView> ViewCache;
 
 /**
  * Cache class, handles caching of views/fonts
@@ -53,12 +58,19 @@ private:
 	void purgeFontCache();
 	void purgeViewCache();
 
+	/**
+	 * Frees least recently used views until there is room for another one,
+	 * both by count and by memory.
+	 */
+	void trimViewCache();
+
 	ResourceManager *_resMan;
 	GfxScreen *_screen;
 	GfxPalette *_palette;
 
 	FontCache _cachedFonts;
 	ViewCache _cachedViews;
+	uint32 _viewUseCounter;
 };
 
 } // End of namespace Sci
@@ -38,15 +38,25 @@ namespace Sci {
 CelScaler *CelObj::_scaler = nullptr;
 
 void CelScaler::activateScaleTables(const Ratio &scaleX, const Ratio &scaleY) {
+	int oldestIndex = 0;
 	for (int i = 0; i < ARRAYSIZE(_scaleTables); ++i) {
 		if (_scaleTables[i].scaleX == scaleX && _scaleTables[i].scaleY == scaleY) {
 			_activeIndex = i;
+			_lastUse[i] = ++_nextUseId;
 			return;
 		}
+
+		if (_lastUse[i] < _lastUse[oldestIndex]) {
+			oldestIndex = i;
+		}
 	}
 
-	const int i = 1 - _activeIndex;
+	// Scenes often draw objects at more than two different scales at once,
+	// so replace the least recently used table instead of alternating
+	// between two tables
+	const int i = oldestIndex;
 	_activeIndex = i;
+	_lastUse[i] = ++_nextUseId;
 	CelScalerTable &table = _scaleTables[i];
 
 	if (table.scaleX != scaleX) {
@@ -90,6 +100,9 @@ void CelObj::init() {
 	_scaler = new CelScaler();
 	_cache = new CelCache;
 	_cache->resize(100);
+	_cacheIndex = new CelCacheIndex;
+	_pixelCache = new CelPixelCache;
+	_pixelCacheSize = 0;
 }
 
 void CelObj::deinit() {
@@ -102,6 +115,16 @@ void CelObj::deinit() {
 	}
 	delete _cache;
 	_cache = nullptr;
+	delete _cacheIndex;
+	_cacheIndex = nullptr;
+	if (_pixelCache != nullptr) {
+		for (CelPixelCache::iterator it = _pixelCache->begin(); it != _pixelCache->end(); ++it) {
+			delete[] it->_value.pixels;
+		}
+	}
+	delete _pixelCache;
+	_pixelCache = nullptr;
+	_pixelCacheSize = 0;
 }
 
 #pragma mark -
@@ -296,87 +319,93 @@ public:
 
 struct READER_Compressed {
 private:
-	const SciSpan<const byte> _resource;
-	byte _buffer[kCelScalerTableSize];
-	uint32 _controlOffset;
-	uint32 _dataOffset;
-	uint32 _uncompressedDataOffset;
-	int16 _y;
+	const byte *_pixels;
+	const int16 _sourceWidth;
 	const int16 _sourceHeight;
-	const uint8 _skipColor;
-	const int16 _maxWidth;
 
-public:
-	READER_Compressed(const CelObj &celObj, const int16 maxWidth) :
-	_resource(celObj.getResPointer()),
-	_y(-1),
-	_sourceHeight(celObj._height),
-	_skipColor(celObj._skipColor),
-	_maxWidth(maxWidth) {
-		assert(maxWidth <= celObj._width);
-
-		const SciSpan<const byte> celHeader = _resource.subspan(celObj._celHeaderOffset);
-		_dataOffset = celHeader.getUint32SEAt(24);
-		_uncompressedDataOffset = celHeader.getUint32SEAt(28);
-		_controlOffset = celHeader.getUint32SEAt(32);
-	}
+	/**
+	 * Decompresses every row of the cel into `target`.
+	 */
+	void decompress(const CelObj &celObj, byte *target) const {
+		const SciSpan<const byte> resource = celObj.getResPointer();
+		const SciSpan<const byte> celHeader = resource.subspan(celObj._celHeaderOffset);
+		const uint32 dataOffset = celHeader.getUint32SEAt(24);
+		const uint32 uncompressedDataOffset = celHeader.getUint32SEAt(28);
+		const uint32 controlOffset = celHeader.getUint32SEAt(32);
+		const uint8 skipColor = celObj._skipColor;
 
-	inline const byte *getRow(const int16 y) {
-		assert(y >= 0 && y < _sourceHeight);
-		if (y != _y) {
+		for (int16 y = 0; y < _sourceHeight; ++y, target += _sourceWidth) {
 			// compressed data segment for row
-			const uint32 rowOffset = _resource.getUint32SEAt(_controlOffset + y * sizeof(uint32));
+			const uint32 rowOffset = resource.getUint32SEAt(controlOffset + y * sizeof(uint32));
 
 			uint32 rowCompressedSize;
 			if (y + 1 < _sourceHeight) {
-				rowCompressedSize = _resource.getUint32SEAt(_controlOffset + (y + 1) * sizeof(uint32)) - rowOffset;
+				rowCompressedSize = resource.getUint32SEAt(controlOffset + (y + 1) * sizeof(uint32)) - rowOffset;
 			} else {
-				rowCompressedSize = _resource.size() - rowOffset - _dataOffset;
+				rowCompressedSize = resource.size() - rowOffset - dataOffset;
 			}
 
-			const byte *row = _resource.getUnsafeDataAt(_dataOffset + rowOffset, rowCompressedSize);
+			const byte *row = resource.getUnsafeDataAt(dataOffset + rowOffset, rowCompressedSize);
 
 			// uncompressed data segment for row
-			const uint32 literalOffset = _resource.getUint32SEAt(_controlOffset + _sourceHeight * sizeof(uint32) + y * sizeof(uint32));
+			const uint32 literalOffset = resource.getUint32SEAt(controlOffset + _sourceHeight * sizeof(uint32) + y * sizeof(uint32));
 
 			uint32 literalRowSize;
 			if (y + 1 < _sourceHeight) {
-				literalRowSize = _resource.getUint32SEAt(_controlOffset + _sourceHeight * sizeof(uint32) + (y + 1) * sizeof(uint32)) - literalOffset;
+				literalRowSize = resource.getUint32SEAt(controlOffset + _sourceHeight * sizeof(uint32) + (y + 1) * sizeof(uint32)) - literalOffset;
 			} else {
-				literalRowSize = _resource.size() - literalOffset - _uncompressedDataOffset;
+				literalRowSize = resource.size() - literalOffset - uncompressedDataOffset;
 			}
 
-			const byte *literal = _resource.getUnsafeDataAt(_uncompressedDataOffset + literalOffset, literalRowSize);
+			const byte *literal = resource.getUnsafeDataAt(uncompressedDataOffset + literalOffset, literalRowSize);
 
 			uint8 length;
-			for (int16 i = 0; i < _maxWidth; i += length) {
+			for (int16 i = 0; i < _sourceWidth; i += length) {
 				const byte controlByte = *row++;
 				length = controlByte;
 
 				// Run-length encoded
 				if (controlByte & 0x80) {
 					length &= 0x3F;
-					assert(i + length < (int)sizeof(_buffer));
+					const int16 count = MIN<int16>(length, _sourceWidth - i);
 
 					// Fill with skip color
 					if (controlByte & 0x40) {
-						memset(_buffer + i, _skipColor, length);
+						memset(target + i, skipColor, count);
 					// Next value is fill color
 					} else {
-						memset(_buffer + i, *literal, length);
+						memset(target + i, *literal, count);
 						++literal;
 					}
 				// Uncompressed
 				} else {
-					assert(i + length < (int)sizeof(_buffer));
-					memcpy(_buffer + i, literal, length);
+					const int16 count = MIN<int16>(length, _sourceWidth - i);
+					memcpy(target + i, literal, count);
 					literal += length;
 				}
 			}
-			_y = y;
 		}
+	}
+
+public:
+	READER_Compressed(const CelObj &celObj, const int16 maxWidth) :
+	_sourceWidth(celObj._width),
+	_sourceHeight(celObj._height) {
+		assert(maxWidth <= celObj._width);
 
-		return _buffer;
+		// Whole cels are decompressed and kept in the pixel cache, so cels
+		// which are drawn every frame only need to be decompressed once
+		_pixels = CelObj::getCachedPixels(celObj._info);
+		if (_pixels == nullptr) {
+			byte *pixels = CelObj::allocateCachedPixels(celObj._info, _sourceWidth * _sourceHeight);
+			decompress(celObj, pixels);
+			_pixels = pixels;
+		}
+	}
+
+	inline const byte *getRow(const int16 y) const {
+		assert(y >= 0 && y < _sourceHeight);
+		return _pixels + y * _sourceWidth;
 	}
 };
 
@@ -410,14 +439,21 @@ struct MAPPER_NoMDNoSkip {
  * remapping data, and remapping enabled.
  */
 struct MAPPER_Map {
+	const GfxRemap32 *const _remap;
+	const uint8 _startColor;
+
+	MAPPER_Map() :
+	_remap(g_sci->_gfxRemap32),
+	_startColor(g_sci->_gfxRemap32->getStartColor()) {}
+
 	inline void draw(byte *target, const byte pixel, const uint8 skipColor) const {
 		if (pixel != skipColor) {
 			// NOTE: For some reason, SSCI never checks if the source
 			// pixel is *above* the range of remaps.
-			if (pixel < g_sci->_gfxRemap32->getStartColor()) {
+			if (pixel < _startColor) {
 				*target = pixel;
-			} else if (g_sci->_gfxRemap32->remapEnabled(pixel)) {
-				*target = g_sci->_gfxRemap32->remapColor(pixel, *target);
+			} else if (_remap->remapEnabled(pixel)) {
+				*target = _remap->remapColor(pixel, *target);
 			}
 		}
 	}
@@ -428,10 +464,15 @@ struct MAPPER_Map {
  * remapping data, and remapping disabled.
  */
 struct MAPPER_NoMap {
+	const uint8 _startColor;
+
+	MAPPER_NoMap() :
+	_startColor(g_sci->_gfxRemap32->getStartColor()) {}
+
 	inline void draw(byte *target, const byte pixel, const uint8 skipColor) const {
 		// NOTE: For some reason, SSCI never checks if the source
 		// pixel is *above* the range of remaps.
-		if (pixel != skipColor && pixel < g_sci->_gfxRemap32->getStartColor()) {
+		if (pixel != skipColor && pixel < _startColor) {
 			*target = pixel;
 		}
 	}
@@ -613,9 +654,20 @@ void CelObj::submitPalette() const {
 
 int CelObj::_nextCacheId = 1;
 CelCache *CelObj::_cache = nullptr;
+CelCacheIndex *CelObj::_cacheIndex = nullptr;
+CelPixelCache *CelObj::_pixelCache = nullptr;
+uint32 CelObj::_pixelCacheSize = 0;
 
 int CelObj::searchCache(const CelInfo32 &celInfo, int *const nextInsertIndex) const {
 	*nextInsertIndex = -1;
+
+	CelCacheIndex::const_iterator cached = _cacheIndex->find(celInfo);
+	if (cached != _cacheIndex->end()) {
+		(*_cache)[cached->_value].id = ++_nextCacheId;
+		return cached->_value;
+	}
+
+	// The cel is not in the cache, so find the slot to replace
 	int oldestId = _nextCacheId + 1;
 	int oldestIndex = 0;
 
@@ -626,9 +678,6 @@ int CelObj::searchCache(const CelInfo32 &celInfo, int *const nextInsertIndex) co
 			if (*nextInsertIndex == -1) {
 				*nextInsertIndex = i;
 			}
-		} else if (entry.celObj->_info == celInfo) {
-			entry.id = ++_nextCacheId;
-			return i;
 		} else if (oldestId > entry.id) {
 			oldestId = entry.id;
 			oldestIndex = i;
@@ -650,11 +699,50 @@ void CelObj::putCopyInCache(const int cacheIndex) const {
 	CelCacheEntry &entry = (*_cache)[cacheIndex];
 
 	if (entry.celObj != nullptr) {
+		CelCacheIndex::iterator indexed = _cacheIndex->find(entry.celObj->_info);
+		if (indexed != _cacheIndex->end() && indexed->_value == cacheIndex) {
+			_cacheIndex->erase(indexed);
+		}
 		delete entry.celObj;
 	}
 
 	entry.celObj = duplicate();
 	entry.id = ++_nextCacheId;
+	(*_cacheIndex)[entry.celObj->_info] = cacheIndex;
+}
+
+const byte *CelObj::getCachedPixels(const CelInfo32 &celInfo) {
+	CelPixelCache::iterator it = _pixelCache->find(celInfo);
+	if (it == _pixelCache->end()) {
+		return nullptr;
+	}
+
+	it->_value.id = ++_nextCacheId;
+	return it->_value.pixels;
+}
+
+byte *CelObj::allocateCachedPixels(const CelInfo32 &celInfo, const uint32 size) {
+	assert(!_pixelCache->contains(celInfo));
+
+	while (!_pixelCache->empty() && _pixelCacheSize + size > kCelPixelCacheSize) {
+		CelPixelCache::iterator oldest = _pixelCache->begin();
+		for (CelPixelCache::iterator it = _pixelCache->begin(); it != _pixelCache->end(); ++it) {
+			if (it->_value.id < oldest->_value.id) {
+				oldest = it;
+			}
+		}
+
+		_pixelCacheSize -= oldest->_value.size;
+		delete[] oldest->_value.pixels;
+		_pixelCache->erase(oldest);
+	}
+
+	CelPixelCacheEntry &entry = (*_pixelCache)[celInfo];
+	entry.id = ++_nextCacheId;
+	entry.pixels = new byte[size];
+	entry.size = size;
+	_pixelCacheSize += size;
+	return entry.pixels;
 }
 
 #pragma mark -
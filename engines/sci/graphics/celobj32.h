@@ -23,6 +23,7 @@
 #ifndef SCI_GRAPHICS_CELOBJ32_H
 #define SCI_GRAPHICS_CELOBJ32_H
 
+#include "common/hashmap.h"
 #include "common/rational.h"
 #include "common/rect.h"
 #include "sci/resource.h"
@@ -110,7 +111,7 @@ struct CelInfo32 {
 	// NOTE: This is the equivalence criteria used by
 	// CelObj::searchCache in at least SCI2.1/SQ6. Notably,
 	// it does not check the color field.
-	inline bool operator==(const CelInfo32 &other) {
+	inline bool operator==(const CelInfo32 &other) const {
 		return (
 			type == other.type &&
 			resourceId == other.resourceId &&
@@ -120,7 +121,7 @@ struct CelInfo32 {
 		);
 	}
 
-	inline bool operator!=(const CelInfo32 &other) {
+	inline bool operator!=(const CelInfo32 &other) const {
 		return !(*this == other);
 	}
 
@@ -140,6 +141,13 @@ struct CelInfo32 {
 	}
 };
 
+struct CelInfo32_Hash {
+	uint operator()(const CelInfo32 &info) const {
+		return (info.type << 28) ^ (info.resourceId << 12) ^ ((uint16)info.loopNo << 8) ^ (uint16)info.celNo ^
+			(info.bitmap.getSegment() << 16) ^ info.bitmap.getOffset();
+	}
+};
+
 class CelObj;
 struct CelCacheEntry {
 	/**
@@ -154,6 +162,42 @@ struct CelCacheEntry {
 
 typedef Common::Array<CelCacheEntry> CelCache;
 
+/**
+ * Maps cel info to the index of the matching entry in the
+ * cel cache, so cache hits do not need to search through
+ * every entry.
+ */
+typedef Common::HashMap<CelInfo32, int, CelInfo32_Hash> CelCacheIndex;
+
+struct CelPixelCacheEntry {
+	/**
+	 * A monotonically increasing cache ID used to identify
+	 * the least recently used item in the cache for
+	 * replacement.
+	 */
+	int id;
+
+	/**
+	 * The decompressed pixels of the cel.
+	 */
+	byte *pixels;
+
+	/**
+	 * The size of `pixels`, in bytes.
+	 */
+	uint32 size;
+};
+
+typedef Common::HashMap<CelInfo32, CelPixelCacheEntry, CelInfo32_Hash> CelPixelCache;
+
+enum {
+	/**
+	 * The maximum number of bytes of decompressed cel
+	 * pixels kept in the pixel cache.
+	 */
+	kCelPixelCacheSize = 4 * 1024 * 1024
+};
+
 #pragma mark -
 #pragma mark CelScaler
 
@@ -161,7 +205,12 @@ enum {
 	/**
 	 * The maximum size of a row/column of scaled pixel data.
 	 */
-	kCelScalerTableSize = 4096
+	kCelScalerTableSize = 4096,
+
+	/**
+	 * The number of cached scale tables.
+	 */
+	kCelScalerTableCount = 4
 };
 
 struct CelScalerTable {
@@ -194,7 +243,19 @@ class CelScaler {
 	/**
 	 * Cached scale tables.
 	 */
-	CelScalerTable _scaleTables[2];
+	CelScalerTable _scaleTables[kCelScalerTableCount];
+
+	/**
+	 * The value of `_nextUseId` when each scale table was
+	 * last used.
+	 */
+	int _lastUse[kCelScalerTableCount];
+
+	/**
+	 * A monotonically increasing ID used to identify the
+	 * least recently used scale table for replacement.
+	 */
+	int _nextUseId;
 
 	/**
 	 * The index of the most recently used scale table.
@@ -220,6 +281,8 @@ class CelScaler {
 public:
 	CelScaler() :
 	_scaleTables(),
+	_lastUse(),
+	_nextUseId(0),
 	_activeIndex(0) {
 		CelScalerTable &table = _scaleTables[0];
 		table.scaleX = Ratio();
@@ -483,6 +546,24 @@ protected:
 	// NOTE: At least SQ6 uses a fixed cache size of 100.
 	static CelCache *_cache;
 
+	/**
+	 * An index of the cel cache, keyed by the cel info of
+	 * each cached cel object.
+	 */
+	static CelCacheIndex *_cacheIndex;
+
+	/**
+	 * A cache of the decompressed pixels of compressed
+	 * cels, so they do not need to be decompressed again
+	 * every time they are drawn.
+	 */
+	static CelPixelCache *_pixelCache;
+
+	/**
+	 * The number of bytes of pixels in the pixel cache.
+	 */
+	static uint32 _pixelCacheSize;
+
 	/**
 	 * Searches the cel cache for a CelObj matching the
 	 * provided CelInfo32. If not found, -1 is returned.
@@ -497,6 +578,22 @@ protected:
 	 * given cache index.
 	 */
 	void putCopyInCache(int index) const;
+
+public:
+	/**
+	 * Returns the cached decompressed pixels for the cel
+	 * with the given cel info, or null if they are not in
+	 * the pixel cache.
+	 */
+	static const byte *getCachedPixels(const CelInfo32 &celInfo);
+
+	/**
+	 * Allocates a buffer of the given size in the pixel
+	 * cache for the decompressed pixels of the cel with the
+	 * given cel info, evicting the least recently used
+	 * pixels if the cache would become too large.
+	 */
+	static byte *allocateCachedPixels(const CelInfo32 &celInfo, uint32 size);
 };
 
 #pragma mark -
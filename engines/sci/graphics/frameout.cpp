@@ -409,6 +409,8 @@ void GfxFrameout::frameOut(const bool shouldShowBits, const Common::Rect &eraseR
 	screenItemLists.resize(_planes.size());
 	eraseLists.resize(_planes.size());
 
+	const uint32 startTime = g_system->getMillis();
+
 	if (g_sci->_gfxRemap32->getRemapCount() > 0 && _remapOccurred) {
 		remapMarkRedraw();
 	}
@@ -419,6 +421,8 @@ void GfxFrameout::frameOut(const bool shouldShowBits, const Common::Rect &eraseR
 		list->sort();
 	}
 
+	const uint32 calcDoneTime = g_system->getMillis();
+
 	for (ScreenItemListList::iterator list = screenItemLists.begin(); list != screenItemLists.end(); ++list) {
 		for (DrawList::iterator drawItem = list->begin(); drawItem != list->end(); ++drawItem) {
 			(*drawItem)->screenItem->getCelObj().submitPalette();
@@ -430,8 +434,11 @@ void GfxFrameout::frameOut(const bool shouldShowBits, const Common::Rect &eraseR
 	for (PlaneList::size_type i = 0; i < _planes.size(); ++i) {
 		drawEraseList(eraseLists[i], *_planes[i]);
 		drawScreenItemList(screenItemLists[i]);
+		_frameOutStats.drawnItems += screenItemLists[i].size();
 	}
 
+	const uint32 drawDoneTime = g_system->getMillis();
+
 	if (robotIsActive) {
 		robotPlayer.frameAlmostVisible();
 	}
@@ -442,6 +449,14 @@ void GfxFrameout::frameOut(const bool shouldShowBits, const Common::Rect &eraseR
 		showBits();
 	}
 
+	const uint32 endTime = g_system->getMillis();
+	++_frameOutStats.frames;
+	_frameOutStats.calcTime += calcDoneTime - startTime;
+	_frameOutStats.drawTime += drawDoneTime - calcDoneTime;
+	_frameOutStats.showTime += endTime - drawDoneTime;
+	_frameOutStats.lastFrameTime = endTime - startTime;
+	_frameOutStats.maxFrameTime = MAX(_frameOutStats.maxFrameTime, _frameOutStats.lastFrameTime);
+
 	if (robotIsActive) {
 		robotPlayer.frameNowVisible();
 	}
@@ -921,6 +936,17 @@ void GfxFrameout::drawScreenItemList(const DrawList &screenItemList) {
 }
 
 void GfxFrameout::mergeToShowList(const Common::Rect &drawRect, RectList &showList, const int overdrawThreshold) {
+	// A rect which is already entirely covered by the show list would just be
+	// merged into the rect covering it, so skip building the merge list. This
+	// is common when many screen items are drawn inside of a larger dirty area
+	if (!drawRect.isEmpty()) {
+		for (RectList::size_type i = 0; i < showList.size(); ++i) {
+			if (showList[i]->contains(drawRect)) {
+				return;
+			}
+		}
+	}
+
 	RectList mergeList;
 	Common::Rect merged;
 	mergeList.add(drawRect);
@@ -1355,6 +1381,19 @@ void GfxFrameout::printVisiblePlaneList(Console *con) const {
 	printPlaneListInternal(con, _visiblePlanes);
 }
 
+void GfxFrameout::printFrameOutStatistics(Console *con) const {
+	const FrameOutStatistics &stats = _frameOutStats;
+	con->debugPrintf("Frames rendered: %d, screen items drawn: %d\n", stats.frames, stats.drawnItems);
+	if (stats.frames == 0) {
+		return;
+	}
+
+	con->debugPrintf("Average frame time: %d ms (calc lists %d ms, draw %d ms, show %d ms)\n",
+		(stats.calcTime + stats.drawTime + stats.showTime) / stats.frames,
+		stats.calcTime / stats.frames, stats.drawTime / stats.frames, stats.showTime / stats.frames);
+	con->debugPrintf("Last frame time: %d ms, slowest frame time: %d ms\n", stats.lastFrameTime, stats.maxFrameTime);
+}
+
 void GfxFrameout::printPlaneItemListInternal(Console *con, const ScreenItemList &screenItemList) const {
 	ScreenItemList::size_type i = 0;
 	for (ScreenItemList::const_iterator sit = screenItemList.begin(); sit != screenItemList.end(); sit++) {
@@ -36,6 +36,28 @@ class GfxCursor32;
 class GfxTransitions32;
 struct PlaneShowStyle;
 
+/**
+ * Timing statistics of the frames rendered by
+ * GfxFrameout::frameOut. All times are in milliseconds.
+ */
+struct FrameOutStatistics {
+	uint32 frames;       ///< Number of frames rendered
+	uint32 drawnItems;   ///< Number of screen items drawn
+	uint32 calcTime;     ///< Time spent calculating the draw and erase lists
+	uint32 drawTime;     ///< Time spent drawing into the internal buffer
+	uint32 showTime;     ///< Time spent copying to the hardware screen
+	uint32 lastFrameTime; ///< Duration of the last frame
+	uint32 maxFrameTime; ///< Duration of the slowest frame
+
+	FrameOutStatistics() { reset(); }
+
+	void reset() {
+		frames = drawnItems = 0;
+		calcTime = drawTime = showTime = 0;
+		lastFrameTime = maxFrameTime = 0;
+	}
+};
+
 /**
  * Frameout class, kFrameout and relevant functions for SCI32 games.
  * Roughly equivalent to GraphicsMgr in the actual SCI engine.
@@ -218,6 +240,12 @@ private:
 	 */
 	int _overdrawThreshold;
 
+	/**
+	 * Timing statistics of the rendered frames, for the
+	 * debugger.
+	 */
+	FrameOutStatistics _frameOutStats;
+
 	/**
 	 * A list of planes that are currently drawn to the
 	 * hardware display surface. Used to calculate
@@ -417,6 +445,8 @@ public:
 	void printPlaneItemList(Console *con, const reg_t planeObject) const;
 	void printVisiblePlaneItemList(Console *con, const reg_t planeObject) const;
 	void printPlaneItemListInternal(Console *con, const ScreenItemList &screenItemList) const;
+	void printFrameOutStatistics(Console *con) const;
+	void resetFrameOutStatistics() { _frameOutStats.reset(); }
 };
 
 } // End of namespace Sci
@@ -39,6 +39,7 @@ namespace Sci {
 #define MAX_CACHED_CURSORS 10
 #define MAX_CACHED_FONTS 20
 #define MAX_CACHED_VIEWS 50
+#define MAX_CACHED_VIEWS_MEMORY (4 * 1024 * 1024) // Resources and decoded cels
 
 enum ShakeDirection {
 	kShakeVertical   = 1,
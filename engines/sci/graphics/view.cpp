@@ -31,7 +31,7 @@
 namespace Sci {
 
 GfxView::GfxView(ResourceManager *resMan, GfxScreen *screen, GfxPalette *palette, GuiResourceId resourceId)
-	: _resMan(resMan), _screen(screen), _palette(palette), _resourceId(resourceId) {
+	: _resMan(resMan), _screen(screen), _palette(palette), _resourceId(resourceId), _decodedSize(0) {
 	assert(resourceId != -1);
 	_coordAdjuster = g_sci->_gfxCoordAdjuster;
 	initData(resourceId);
@@ -411,6 +411,10 @@ uint16 GfxView::getCelCount(int16 loopNo) const {
 	return _loop[loopNo].cel.size();
 }
 
+uint32 GfxView::getMemoryUsage() const {
+	return _resource->size() + _decodedSize;
+}
+
 Palette *GfxView::getPalette() {
 	return _embeddedPal ? &_viewPalette : NULL;
 }
@@ -668,6 +672,7 @@ const SciSpan<const byte> &GfxView::getBitmap(int16 loopNo, int16 celNo) {
 	const Common::String sourceName = Common::String::format("%s loop %d cel %d", _resource->name().c_str(), loopNo, celNo);
 
 	SciSpan<byte> outBitmap = cel.rawBitmap->allocate(pixelCount, sourceName);
+	_decodedSize += pixelCount;
 
 	// unpack the actual cel bitmap data
 	unpackCel(loopNo, celNo, outBitmap);
@@ -824,6 +829,8 @@ void GfxView::draw(const Common::Rect &rect, const Common::Rect &clipRect, const
 			}
 		}
 	} else {
+		// SCI16 remapping (QFG4 demo)
+		GfxRemap *remap = g_sci->_gfxRemap16;
 		for (int y = 0; y < height; y++, bitmapData += celWidth) {
 			for (int x = 0; x < width; x++) {
 				const byte color = bitmapData[x];
@@ -832,9 +839,8 @@ void GfxView::draw(const Common::Rect &rect, const Common::Rect &clipRect, const
 					const int y2 = clipRectTranslated.top + y;
 					if (priority >= _screen->getPriority(x2, y2)) {
 						byte outputColor = palette->mapping[color];
-						// SCI16 remapping (QFG4 demo)
-						if (g_sci->_gfxRemap16 && g_sci->_gfxRemap16->isRemapped(outputColor))
-							outputColor = g_sci->_gfxRemap16->remapColor(outputColor, _screen->getVisual(x2, y2));
+						if (remap && remap->isRemapped(outputColor))
+							outputColor = remap->remapColor(outputColor, _screen->getVisual(x2, y2));
 						_screen->putPixel(x2, y2, drawMask, outputColor, priority, 0);
 					}
 				}
@@ -916,6 +922,8 @@ void GfxView::drawScaled(const Common::Rect &rect, const Common::Rect &clipRect,
 	assert(scaledHeight + offsetY <= ARRAYSIZE(scalingY));
 	assert(scaledWidth + offsetX <= ARRAYSIZE(scalingX));
 	const byte *bitmapData = bitmap.getUnsafeDataAt(0, celWidth * celHeight);
+	// SCI16 remapping (QFG4 demo)
+	GfxRemap *remap = g_sci->_gfxRemap16;
 	for (int y = 0; y < scaledHeight; y++) {
 		for (int x = 0; x < scaledWidth; x++) {
 			const byte color = bitmapData[scalingY[y + offsetY] * celWidth + scalingX[x + offsetX]];
@@ -923,9 +931,8 @@ void GfxView::drawScaled(const Common::Rect &rect, const Common::Rect &clipRect,
 			const int y2 = clipRectTranslated.top + y;
 			if (color != clearKey && priority >= _screen->getPriority(x2, y2)) {
 				byte outputColor = palette->mapping[color];
-				// SCI16 remapping (QFG4 demo)
-				if (g_sci->_gfxRemap16 && g_sci->_gfxRemap16->isRemapped(outputColor))
-					outputColor = g_sci->_gfxRemap16->remapColor(outputColor, _screen->getVisual(x2, y2));
+				if (remap && remap->isRemapped(outputColor))
+					outputColor = remap->remapColor(outputColor, _screen->getVisual(x2, y2));
 				_screen->putPixel(x2, y2, drawMask, outputColor, priority, 0);
 			}
 		}
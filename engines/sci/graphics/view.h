@@ -81,6 +81,13 @@ public:
 	void drawScaled(const Common::Rect &rect, const Common::Rect &clipRect, const Common::Rect &clipRectTranslated, int16 loopNo, int16 celNo, byte priority, int16 scaleX, int16 scaleY);
 	uint16 getLoopCount() const { return _loop.size(); }
 	uint16 getCelCount(int16 loopNo) const;
+
+	/**
+	 * Returns the number of bytes used by the view resource and the cels
+	 * decoded so far.
+	 */
+	uint32 getMemoryUsage() const;
+
 	Palette *getPalette();
 
 	bool isScaleable();
@@ -114,6 +121,8 @@ private:
 	// this is set for sci0early to adjust for the getCelRect() change
 	int16 _adjustForSci0Early;
 
+	uint32 _decodedSize; ///< Number of bytes of all decoded cel bitmaps
+
 	// this is not set for some views in laura bow 2 floppy and signals that the view shall never get scaled
 	//  even if scaleX/Y are set (inside kAnimate)
 	bool _isScaleable;
@@ -22,6 +22,7 @@
 
 // Resource library
 
+#include "common/config-manager.h"
 #include "common/file.h"
 #include "common/fs.h"
 #include "common/macresman.h"
@@ -45,6 +46,10 @@ enum {
 	SCI11_RESMAP_ENTRIES_SIZE = 5
 };
 
+enum {
+	kLRUEvictionWindow = 8 ///< Number of least recently used resources considered for eviction at a time
+};
+
 /** resource type for SCI1 resource.map file */
 struct resource_index_t {
 	uint16 wOffset;
@@ -1009,9 +1014,15 @@ void ResourceManager::init() {
 	// cache, leading to constant decompression of picture resources
 	// and making the renderer very slow.
 	if (getSciVersion() >= SCI_VERSION_2) {
-		_maxMemoryLRU = 4096 * 1024; // 4MiB
+		_maxMemoryLRU = 16384 * 1024; // 16MiB
+	} else {
+		_maxMemoryLRU = 2048 * 1024; // 2MiB
 	}
 
+	// Allow the user to override the cache size, e.g. on low memory systems
+	if (ConfMan.hasKey("resource_cache_size"))
+		_maxMemoryLRU = MAX(ConfMan.getInt("resource_cache_size"), 0) * 1024;
+
 	switch (_viewType) {
 	case kViewEga:
 		debugC(1, kDebugLevelResMan, "resMan: Detected EGA graphic resources");
@@ -1058,7 +1069,7 @@ void ResourceManager::removeFromLRU(Resource *res) {
 		warning("resMan: trying to remove resource that isn't enqueued");
 		return;
 	}
-	_LRU.remove(res);
+	_LRU.erase(res->_lruPosition);
 	_memoryLRU -= res->size();
 	res->_status = kResStatusAllocated;
 }
@@ -1069,6 +1080,7 @@ void ResourceManager::addToLRU(Resource *res) {
 		return;
 	}
 	_LRU.push_front(res);
+	res->_lruPosition = _LRU.begin();
 	_memoryLRU += res->size();
 #if SCI_VERBOSE_RESMAN
 	debug("Adding %s (%d bytes) to lru control: %d bytes total",
@@ -1098,7 +1110,19 @@ void ResourceManager::printLRU() {
 void ResourceManager::freeOldResources() {
 	while (_maxMemoryLRU < _memoryLRU) {
 		assert(!_LRU.empty());
-		Resource *goner = _LRU.back();
+
+		// Size-aware eviction: of the least recently used resources, free
+		// the largest one first. This frees the budget with as few
+		// evictions as possible, and keeps small resources (cheap to keep,
+		// but each costing a disk read when reloaded) cached for longer.
+		Common::List<Resource *>::iterator it = _LRU.end();
+		Resource *goner = 0;
+		for (int i = 0; i < kLRUEvictionWindow && it != _LRU.begin(); ++i) {
+			--it;
+			if (!goner || (*it)->size() > goner->size())
+				goner = *it;
+		}
+
 		removeFromLRU(goner);
 		goner->unalloc();
 #ifdef SCI_VERBOSE_RESMAN
@@ -286,6 +286,7 @@ protected:
 	int32 _fileOffset; /**< Offset in file */
 	ResourceStatus _status;
 	uint16 _lockers; /**< Number of places where this resource was locked */
+	Common::List<Resource *>::iterator _lruPosition; /**< Position in the LRU list, if enqueued */
 	ResourceSource *_source;
 	ResourceManager *_resMan;
 
@@ -25,6 +25,8 @@
 #include "common/debug-channels.h"
 #include "common/translation.h"
 
+#include "audio/audiocache.h"
+
 #include "engines/advancedDetector.h"
 #include "engines/util.h"
 
@@ -234,6 +236,9 @@ SciEngine::~SciEngine() {
 	delete _gfxScreen;
 
 	delete _audio;
+	// Nothing plays from the decoded audio cache anymore, so free it instead
+	// of keeping this game's sounds around after returning to the launcher
+	DecodedAudioCacheMan.clear();
 	delete _sync;
 	delete _soundCmd;
 	delete _kernel;
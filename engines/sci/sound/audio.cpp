@@ -32,6 +32,7 @@
 #include "common/memstream.h"
 #include "common/system.h"
 
+#include "audio/audiocache.h"
 #include "audio/audiostream.h"
 #include "audio/decoders/aiff.h"
 #include "audio/decoders/flac.h"
@@ -398,8 +399,27 @@ Audio::RewindableAudioStream *AudioPlayer::getAudioStream(uint32 number, uint32
 			Common::MemoryReadStream headerStream = audioRes->subspan(kResourceHeaderSize, headerSize).toStream();
 
 			if (readSOLHeader(&headerStream, headerSize, size, _audioRate, audioFlags, audioRes->size())) {
-				Common::MemoryReadStream dataStream(audioRes->subspan(kResourceHeaderSize + headerSize).toStream());
-				data = readSOLAudio(&dataStream, size, audioFlags, flags);
+				const uint32 dataOffset = kResourceHeaderSize + headerSize;
+
+				if (audioFlags & kSolFlagCompressed) {
+					// DPCM decoding is comparatively expensive and the same
+					// speech and sound effects get played over and over, so
+					// keep the decoded samples around. Volume file names are
+					// the same across games, so the key includes the target.
+					const Audio::DecodedAudioKey key(g_sci->getFilePrefix() + "/" + audioRes->getResourceLocation() + "/" + audioRes->name(),
+					                                 dataOffset, size, MKTAG('S','O','L',audioFlags));
+
+					audioSeekStream = DecodedAudioCacheMan.createStream(key);
+					if (!audioSeekStream) {
+						Common::MemoryReadStream dataStream(audioRes->subspan(dataOffset).toStream());
+						data = readSOLAudio(&dataStream, size, audioFlags, flags);
+						audioSeekStream = DecodedAudioCacheMan.addAndCreateStream(key, data, size, _audioRate, flags);
+						data = 0;
+					}
+				} else {
+					Common::MemoryReadStream dataStream(audioRes->subspan(dataOffset).toStream());
+					data = readSOLAudio(&dataStream, size, audioFlags, flags);
+				}
 			}
 		} else if (audioRes->size() > 4 && audioRes->getUint32BEAt(0) == MKTAG('R','I','F','F')) {
 			// WAVE detected
@@ -380,15 +380,24 @@ int Audio32::readBuffer(Audio::st_sample_t *const buffer, const int numSamples)
 				_monitoredBufferSize = bufferSize;
 			}
 
-			memset(_monitoredBuffer, 0, _monitoredBufferSize);
+			// Only the part of the buffer which is written by this callback
+			// needs to be cleared, since the converter mixes into it
+			memset(_monitoredBuffer, 0, bufferSize);
 
 			_numMonitoredSamples = writeAudioInternal(channel.stream, channel.converter, _monitoredBuffer, numSamples, leftVolume, rightVolume);
 
-			Audio::st_sample_t *sourceBuffer = _monitoredBuffer;
-			Audio::st_sample_t *targetBuffer = buffer;
-			const Audio::st_sample_t *const end = _monitoredBuffer + _numMonitoredSamples;
-			while (sourceBuffer != end) {
-				Audio::clampedAdd(*targetBuffer++, *sourceBuffer++);
+			if (playOnlyMonitoredChannel) {
+				// All other channels are mixed in at zero volume, so the
+				// output buffer is still silent and the monitored samples
+				// can be copied over without mixing
+				memcpy(buffer, _monitoredBuffer, _numMonitoredSamples * sizeof(Audio::st_sample_t));
+			} else {
+				Audio::st_sample_t *sourceBuffer = _monitoredBuffer;
+				Audio::st_sample_t *targetBuffer = buffer;
+				const Audio::st_sample_t *const end = _monitoredBuffer + _numMonitoredSamples;
+				while (sourceBuffer != end) {
+					Audio::clampedAdd(*targetBuffer++, *sourceBuffer++);
+				}
 			}
 
 			if (_numMonitoredSamples > maxSamplesWritten) {
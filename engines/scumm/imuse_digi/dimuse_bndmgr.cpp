@@ -36,14 +36,12 @@ BundleDirCache::BundleDirCache() {
 		_budleDirCache[fileId].fileName[0] = 0;
 		_budleDirCache[fileId].numFiles = 0;
 		_budleDirCache[fileId].isCompressed = false;
-		_budleDirCache[fileId].indexTable = NULL;
 	}
 }
 
 BundleDirCache::~BundleDirCache() {
 	for (int fileId = 0; fileId < ARRAYSIZE(_budleDirCache); fileId++) {
 		free(_budleDirCache[fileId].bundleTable);
-		free(_budleDirCache[fileId].indexTable);
 	}
 }
 
@@ -55,8 +53,8 @@ int32 BundleDirCache::getNumFiles(int slot) {
 	return _budleDirCache[slot].numFiles;
 }
 
-BundleDirCache::IndexNode *BundleDirCache::getIndexTable(int slot) {
-	return _budleDirCache[slot].indexTable;
+BundleDirCache::IndexMap *BundleDirCache::getIndexMap(int slot) {
+	return &_budleDirCache[slot].indexMap;
 }
 
 bool BundleDirCache::isSndDataExtComp(int slot) {
@@ -102,9 +100,8 @@ int BundleDirCache::matchFile(const char *filename) {
 
 		file.seek(offset, SEEK_SET);
 
-		_budleDirCache[freeSlot].indexTable =
-				(IndexNode *)calloc(_budleDirCache[freeSlot].numFiles, sizeof(IndexNode));
-		assert(_budleDirCache[freeSlot].indexTable);
+		IndexMap &indexMap = _budleDirCache[freeSlot].indexMap;
+		indexMap.clear();
 
 		for (int32 i = 0; i < _budleDirCache[freeSlot].numFiles; i++) {
 			char name[24], c;
@@ -127,12 +124,12 @@ int BundleDirCache::matchFile(const char *filename) {
 			}
 			_budleDirCache[freeSlot].bundleTable[i].offset = file.readUint32BE();
 			_budleDirCache[freeSlot].bundleTable[i].size = file.readUint32BE();
-			strcpy(_budleDirCache[freeSlot].indexTable[i].filename,
-					_budleDirCache[freeSlot].bundleTable[i].filename);
-			_budleDirCache[freeSlot].indexTable[i].index = i;
+
+			// Keep the first entry for duplicate names
+			const Common::String entryName(_budleDirCache[freeSlot].bundleTable[i].filename);
+			if (!indexMap.contains(entryName))
+				indexMap[entryName] = i;
 		}
-		qsort(_budleDirCache[freeSlot].indexTable, _budleDirCache[freeSlot].numFiles,
-				sizeof(IndexNode), (int (*)(const void*, const void*))scumm_stricmp);
 		return freeSlot;
 	} else {
 		return fileId;
@@ -149,6 +146,9 @@ BundleMgr::BundleMgr(BundleDirCache *cache) {
 	_fileBundleId = -1;
 	_file = new ScummFile();
 	_compInputBuff = NULL;
+	_readAheadBuff = NULL;
+	_readAheadSize = 0;
+	resetBlockCache();
 }
 
 BundleMgr::~BundleMgr() {
@@ -157,14 +157,11 @@ BundleMgr::~BundleMgr() {
 }
 
 Common::SeekableReadStream *BundleMgr::getFile(const char *filename, int32 &offset, int32 &size) {
-	BundleDirCache::IndexNode target;
-	strcpy(target.filename, filename);
-	BundleDirCache::IndexNode *found = (BundleDirCache::IndexNode *)bsearch(&target, _indexTable, _numFiles,
-			sizeof(BundleDirCache::IndexNode), (int (*)(const void*, const void*))scumm_stricmp);
-	if (found) {
-		_file->seek(_bundleTable[found->index].offset, SEEK_SET);
-		offset = _bundleTable[found->index].offset;
-		size = _bundleTable[found->index].size;
+	BundleDirCache::IndexMap::const_iterator found = _indexMap->find(filename);
+	if (found != _indexMap->end()) {
+		_file->seek(_bundleTable[found->_value].offset, SEEK_SET);
+		offset = _bundleTable[found->_value].offset;
+		size = _bundleTable[found->_value].size;
 		return _file;
 	}
 
@@ -190,11 +187,10 @@ bool BundleMgr::open(const char *filename, bool &compressed, bool errorFlag) {
 	_numFiles = _cache->getNumFiles(slot);
 	assert(_numFiles);
 	_bundleTable = _cache->getTable(slot);
-	_indexTable = _cache->getIndexTable(slot);
+	_indexMap = _cache->getIndexMap(slot);
 	assert(_bundleTable);
 	_compTableLoaded = false;
-	_outputSize = 0;
-	_lastBlock = -1;
+	resetBlockCache();
 
 	return true;
 }
@@ -206,14 +202,87 @@ void BundleMgr::close() {
 		_numFiles = 0;
 		_numCompItems = 0;
 		_compTableLoaded = false;
-		_lastBlock = -1;
-		_outputSize = 0;
 		_curSampleId = -1;
 		free(_compTable);
 		_compTable = NULL;
 		free(_compInputBuff);
 		_compInputBuff = NULL;
+		free(_readAheadBuff);
+		_readAheadBuff = NULL;
+		_readAheadSize = 0;
+		resetBlockCache();
+	}
+}
+
+void BundleMgr::resetBlockCache() {
+	for (int i = 0; i < kNumCachedBlocks; i++) {
+		_blockCache[i].block = -1;
+		_blockCache[i].outputSize = 0;
+		_blockCache[i].lastUsed = 0;
+	}
+	_blockCacheCounter = 0;
+	_readAheadStart = _readAheadEnd = 0;
+}
+
+void BundleMgr::readCompressedBlock(int32 index, int32 block) {
+	const int32 start = _bundleTable[index].offset + _compTable[block].offset;
+	const int32 size = _compTable[block].size;
+
+	if (start < _readAheadStart || start + size > _readAheadEnd) {
+		// Music is streamed block after block, so read the compressed data
+		// of the following blocks along with this one while the file is
+		// positioned here anyway
+		int32 end = start + size;
+		for (int32 i = block + 1; i < _numCompItems && i < block + kReadAheadBlocks; i++) {
+			const int32 nextStart = _bundleTable[index].offset + _compTable[i].offset;
+			if (nextStart != end)
+				break;
+			end = nextStart + _compTable[i].size;
+		}
+
+		if (end - start > _readAheadSize) {
+			free(_readAheadBuff);
+			_readAheadSize = end - start;
+			_readAheadBuff = (byte *)malloc(_readAheadSize);
+			assert(_readAheadBuff);
+		}
+
+		_file->seek(start, SEEK_SET);
+		_readAheadStart = start;
+		_readAheadEnd = start + _file->read(_readAheadBuff, end - start);
 	}
+
+	// The file may end early, in which case the rest is left blank
+	const int32 available = CLIP<int32>(_readAheadEnd - start, 0, size);
+	memcpy(_compInputBuff, _readAheadBuff + (start - _readAheadStart), available);
+	// CMI hack: one more zero byte at the end of input buffer
+	memset(_compInputBuff + available, 0, size - available + 1);
+}
+
+BundleMgr::CachedBlock *BundleMgr::getBlock(int32 index, int32 block) {
+	CachedBlock *cached = &_blockCache[0];
+
+	for (int i = 0; i < kNumCachedBlocks; i++) {
+		if (_blockCache[i].block == block) {
+			cached = &_blockCache[i];
+			cached->lastUsed = ++_blockCacheCounter;
+			return cached;
+		}
+
+		if (_blockCache[i].lastUsed < cached->lastUsed)
+			cached = &_blockCache[i];
+	}
+
+	// Replace the least recently used block
+	readCompressedBlock(index, block);
+	cached->outputSize = BundleCodecs::decompressCodec(_compTable[block].codec, _compInputBuff, cached->data, _compTable[block].size);
+	if (cached->outputSize > kBlockSize) {
+		error("_outputSize: %d", cached->outputSize);
+	}
+	cached->block = block;
+	cached->lastUsed = ++_blockCacheCounter;
+
+	return cached;
 }
 
 bool BundleMgr::loadCompTable(int32 index) {
@@ -287,19 +356,9 @@ int32 BundleMgr::decompressSampleByIndex(int32 index, int32 offset, int32 size,
 	skip = (offset + headerSize) % 0x2000;
 
 	for (i = firstBlock; i <= lastBlock; i++) {
-		if (_lastBlock != i) {
-			// CMI hack: one more zero byte at the end of input buffer
-			_compInputBuff[_compTable[i].size] = 0;
-			_file->seek(_bundleTable[index].offset + _compTable[i].offset, SEEK_SET);
-			_file->read(_compInputBuff, _compTable[i].size);
-			_outputSize = BundleCodecs::decompressCodec(_compTable[i].codec, _compInputBuff, _compOutputBuff, _compTable[i].size);
-			if (_outputSize > 0x2000) {
-				error("_outputSize: %d", _outputSize);
-			}
-			_lastBlock = i;
-		}
+		const CachedBlock *block = getBlock(index, i);
 
-		outputSize = _outputSize;
+		outputSize = block->outputSize;
 
 		if (headerOutside) {
 			outputSize -= skip;
@@ -316,7 +375,7 @@ int32 BundleMgr::decompressSampleByIndex(int32 index, int32 offset, int32 size,
 
 		assert(finalSize + outputSize <= blocksFinalSize);
 
-		memcpy(*compFinal + finalSize, _compOutputBuff + skip, outputSize);
+		memcpy(*compFinal + finalSize, block->data + skip, outputSize);
 		finalSize += outputSize;
 
 		size -= outputSize;
@@ -338,12 +397,9 @@ int32 BundleMgr::decompressSampleByName(const char *name, int32 offset, int32 si
 		return 0;
 	}
 
-	BundleDirCache::IndexNode target;
-	strcpy(target.filename, name);
-	BundleDirCache::IndexNode *found = (BundleDirCache::IndexNode *)bsearch(&target, _indexTable, _numFiles,
-			sizeof(BundleDirCache::IndexNode), (int (*)(const void*, const void*))scumm_stricmp);
-	if (found) {
-		final_size = decompressSampleByIndex(found->index, offset, size, comp_final, 0, header_outside);
+	BundleDirCache::IndexMap::const_iterator found = _indexMap->find(name);
+	if (found != _indexMap->end()) {
+		final_size = decompressSampleByIndex(found->_value, offset, size, comp_final, 0, header_outside);
 		return final_size;
 	}
 
@@ -25,6 +25,8 @@
 
 #include "common/scummsys.h"
 #include "common/file.h"
+#include "common/hash-str.h"
+#include "common/hashmap.h"
 
 namespace Scumm {
 
@@ -38,10 +40,7 @@ public:
 		int32 size;
 	};
 
-	struct IndexNode {
-		char filename[24];
-		int32 index;
-	};
+	typedef Common::HashMap<Common::String, int32, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> IndexMap;
 
 private:
 
@@ -50,7 +49,7 @@ private:
 		AudioTable *bundleTable;
 		int32 numFiles;
 		bool isCompressed;
-		IndexNode *indexTable;
+		IndexMap indexMap;
 	} _budleDirCache[4];
 
 public:
@@ -59,7 +58,7 @@ public:
 
 	int matchFile(const char *filename);
 	AudioTable *getTable(int slot);
-	IndexNode *getIndexTable(int slot);
+	IndexMap *getIndexMap(int slot);
 	int32 getNumFiles(int slot);
 	bool isSndDataExtComp(int slot);
 };
@@ -74,9 +73,23 @@ private:
 		int32 codec;
 	};
 
+	enum {
+		kBlockSize = 0x2000,
+		kNumCachedBlocks = 4,
+		kReadAheadBlocks = 8
+	};
+
+	/** A decompressed block of the current sample. */
+	struct CachedBlock {
+		int32 block;
+		int32 outputSize;
+		uint32 lastUsed;
+		byte data[kBlockSize];
+	};
+
 	BundleDirCache *_cache;
 	BundleDirCache::AudioTable *_bundleTable;
-	BundleDirCache::IndexNode *_indexTable;
+	BundleDirCache::IndexMap *_indexMap;
 	CompTable *_compTable;
 
 	int _numFiles;
@@ -85,12 +98,21 @@ private:
 	BaseScummFile *_file;
 	bool _compTableLoaded;
 	int _fileBundleId;
-	byte _compOutputBuff[0x2000];
 	byte *_compInputBuff;
-	int _outputSize;
-	int _lastBlock;
+
+	CachedBlock _blockCache[kNumCachedBlocks];
+	uint32 _blockCacheCounter;
+
+	/** Compressed data of several consecutive blocks, read in one go. */
+	byte *_readAheadBuff;
+	int32 _readAheadSize;
+	int32 _readAheadStart;
+	int32 _readAheadEnd;
 
 	bool loadCompTable(int32 index);
+	void resetBlockCache();
+	CachedBlock *getBlock(int32 index, int32 block);
+	void readCompressedBlock(int32 index, int32 block);
 
 public:
 
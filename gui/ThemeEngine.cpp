@@ -770,6 +770,8 @@ bool ThemeEngine::addBitmap(const Common::String &filename) {
 		// Maybe it is PNG?
 #ifdef USE_PNG
 		Image::PNGDecoder decoder;
+		// Have the rows converted while decoding
+		decoder.setOutputPixelFormat(_overlayFormat);
 		Common::ArchiveMemberList members;
 		_themeFiles.listMatchingMembers(members, filename);
 		for (Common::ArchiveMemberList::const_iterator i = members.begin(), end = members.end(); i != end; ++i) {
@@ -785,8 +787,14 @@ bool ThemeEngine::addBitmap(const Common::String &filename) {
 			}
 		}
 
-		if (srcSurface && srcSurface->format.bytesPerPixel != 1)
+		// The rows were converted while decoding, so the surface only has
+		// to be copied out of the decoder
+		if (srcSurface && srcSurface->format == _overlayFormat) {
+			surf = new Graphics::Surface();
+			surf->copyFrom(*srcSurface);
+		} else if (srcSurface && srcSurface->format.bytesPerPixel != 1) {
 			surf = srcSurface->convertTo(_overlayFormat);
+		}
 #else
 		error("No PNG support compiled in");
 #endif
@@ -806,8 +814,12 @@ bool ThemeEngine::addBitmap(const Common::String &filename) {
 			}
 		}
 
-		if (srcSurface && srcSurface->format.bytesPerPixel != 1)
+		if (srcSurface && srcSurface->format == _overlayFormat) {
+			surf = new Graphics::Surface();
+			surf->copyFrom(*srcSurface);
+		} else if (srcSurface && srcSurface->format.bytesPerPixel != 1) {
 			surf = srcSurface->convertTo(_overlayFormat);
+		}
 	}
 
 	// Store the surface into our hashmap (attention, may store NULL entries!)
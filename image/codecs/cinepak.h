@@ -47,6 +47,7 @@ struct CinepakStrip {
 	Common::Rect rect;
 	CinepakCodebook v1_codebook[256], v4_codebook[256];
 	byte v1_dither[256 * 4 * 4 * 4], v4_dither[256 * 4 * 4 * 4];
+	uint32 v1_color[256 * 4], v4_color[256 * 4]; // Codebooks expanded to the output pixel format
 };
 
 struct CinepakFrame {
@@ -96,10 +97,12 @@ private:
 
 	void loadCodebook(Common::SeekableReadStream &stream, uint16 strip, byte codebookType, byte chunkID, uint32 chunkSize);
 	void decodeVectors(Common::SeekableReadStream &stream, uint16 strip, byte chunkID, uint32 chunkSize);
+	void expandCodebook(uint16 strip, byte codebookType, uint16 codebookIndex);
 
 	byte findNearestRGB(int index) const;
 	void ditherVectors(Common::SeekableReadStream &stream, uint16 strip, byte chunkID, uint32 chunkSize);
 	void ditherCodebookQT(uint16 strip, byte codebookType, uint16 codebookIndex);
+	void ditherCodebookVFW(uint16 strip, byte codebookType, uint16 codebookIndex);
 };
 
 } // End of namespace Image
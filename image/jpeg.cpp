@@ -29,6 +29,7 @@
 #include "common/debug.h"
 #include "common/endian.h"
 #include "common/stream.h"
+#include "common/system.h"
 #include "common/textconsole.h"
 #include "graphics/pixelformat.h"
 
@@ -44,7 +45,8 @@ extern "C" {
 
 namespace Image {
 
-JPEGDecoder::JPEGDecoder() : _surface(), _colorSpace(kColorSpaceRGBA) {
+JPEGDecoder::JPEGDecoder() : _surface(), _colorSpace(kColorSpaceRGBA),
+	_outputPixelFormat(4, 8, 8, 8, 0, 24, 16, 8, 0) {
 }
 
 JPEGDecoder::~JPEGDecoder() {
@@ -70,6 +72,11 @@ Graphics::PixelFormat JPEGDecoder::getPixelFormat() const {
 	return _surface.format;
 }
 
+void JPEGDecoder::setOutputPixelFormat(const Graphics::PixelFormat &format) {
+	assert(format.bytesPerPixel == 2 || format.bytesPerPixel == 4);
+	_outputPixelFormat = format;
+}
+
 #ifdef USE_JPEG
 namespace {
 
@@ -179,6 +186,9 @@ bool JPEGDecoder::loadStream(Common::SeekableReadStream &stream) {
 	// Reset member variables from previous decodings
 	destroy();
 
+	const uint32 startTime = g_system->getMillis();
+	const int32 startPos = stream.pos();
+
 	jpeg_decompress_struct cinfo;
 	jpeg_error_mgr jerr;
 
@@ -213,8 +223,8 @@ bool JPEGDecoder::loadStream(Common::SeekableReadStream &stream) {
 	// Allocate buffers for the output data
 	switch (_colorSpace) {
 	case kColorSpaceRGBA:
-		// We use RGBA8888 in this scenario
-		_surface.create(cinfo.output_width, cinfo.output_height, Graphics::PixelFormat(4, 8, 8, 8, 0, 24, 16, 8, 0));
+		// We use RGBA8888 in this scenario, unless asked otherwise
+		_surface.create(cinfo.output_width, cinfo.output_height, _outputPixelFormat);
 		break;
 
 	case kColorSpaceYUV:
@@ -227,7 +237,7 @@ bool JPEGDecoder::loadStream(Common::SeekableReadStream &stream) {
 	// Allocate buffer for one scanline
 	assert(cinfo.output_components == 3);
 	JDIMENSION pitch = cinfo.output_width * cinfo.output_components;
-	assert(_surface.pitch >= pitch);
+	assert(_colorSpace != kColorSpaceYUV || _surface.pitch >= pitch);
 	JSAMPARRAY buffer = (*cinfo.mem->alloc_sarray)((j_common_ptr)&cinfo, JPOOL_IMAGE, pitch, 1);
 
 	// Go through the image data scanline by scanline
@@ -238,25 +248,35 @@ bool JPEGDecoder::loadStream(Common::SeekableReadStream &stream) {
 
 		const byte *src = buffer[0];
 		switch (_colorSpace) {
-		case kColorSpaceRGBA: {
-			for (int remaining = cinfo.output_width; remaining > 0; --remaining) {
-				byte r = *src++;
-				byte g = *src++;
-				byte b = *src++;
-				// We need to insert a alpha value of 255 (opaque) here.
+		case kColorSpaceRGBA:
+			if (_surface.format == Graphics::PixelFormat(4, 8, 8, 8, 0, 24, 16, 8, 0)) {
+				for (int remaining = cinfo.output_width; remaining > 0; --remaining) {
+					byte r = *src++;
+					byte g = *src++;
+					byte b = *src++;
+					// We need to insert a alpha value of 255 (opaque) here.
 #ifdef SCUMM_BIG_ENDIAN
-				*dst++ = r;
-				*dst++ = g;
-				*dst++ = b;
-				*dst++ = 0xFF;
+					*dst++ = r;
+					*dst++ = g;
+					*dst++ = b;
+					*dst++ = 0xFF;
 #else
-				*dst++ = 0xFF;
-				*dst++ = b;
-				*dst++ = g;
-				*dst++ = r;
+					*dst++ = 0xFF;
+					*dst++ = b;
+					*dst++ = g;
+					*dst++ = r;
 #endif
+				}
+			} else if (_surface.format.bytesPerPixel == 2) {
+				uint16 *dst16 = (uint16 *)dst;
+				for (int remaining = cinfo.output_width; remaining > 0; --remaining, src += 3)
+					*dst16++ = _surface.format.RGBToColor(src[0], src[1], src[2]);
+			} else {
+				uint32 *dst32 = (uint32 *)dst;
+				for (int remaining = cinfo.output_width; remaining > 0; --remaining, src += 3)
+					*dst32++ = _surface.format.RGBToColor(src[0], src[1], src[2]);
 			}
-			} break;
+			break;
 
 		case kColorSpaceYUV:
 			memcpy(dst, src, pitch);
@@ -268,6 +288,9 @@ bool JPEGDecoder::loadStream(Common::SeekableReadStream &stream) {
 	jpeg_finish_decompress(&cinfo);
 	jpeg_destroy_decompress(&cinfo);
 
+	debug(4, "JPEGDecoder: Decoded %dx%d image from %d bytes in %d ms", _surface.w, _surface.h,
+	      stream.pos() - startPos, g_system->getMillis() - startTime);
+
 	return true;
 #else
 	return false;
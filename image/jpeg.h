@@ -92,9 +92,22 @@ public:
 	 */
 	void setOutputColorSpace(ColorSpace outSpace) { _colorSpace = outSpace; }
 
+	/**
+	 * Request the pixel format of the decoded surface when outputting RGB
+	 * data. Scanlines are converted to this format as they are decoded,
+	 * so callers do not need to convert the whole image afterwards.
+	 *
+	 * The format needs to have 2 or 4 bytes per pixel. The decoder itself
+	 * defaults to 32bit RGBA.
+	 *
+	 * @param format The pixel format to output.
+	 */
+	void setOutputPixelFormat(const Graphics::PixelFormat &format);
+
 private:
 	Graphics::Surface _surface;
 	ColorSpace _colorSpace;
+	Graphics::PixelFormat _outputPixelFormat;
 };
 
 } // End of namespace Image
@@ -31,17 +31,25 @@
 
 #include "image/png.h"
 
+#include "graphics/conversion.h"
 #include "graphics/pixelformat.h"
 #include "graphics/surface.h"
 
 #include "common/array.h"
+#include "common/debug.h"
 #include "common/stream.h"
+#include "common/system.h"
 
 namespace Image {
 
 PNGDecoder::PNGDecoder() : _outputSurface(0), _palette(0), _paletteColorCount(0), _skipSignature(false) {
 }
 
+void PNGDecoder::setOutputPixelFormat(const Graphics::PixelFormat &format) {
+	assert(format.bytesPerPixel == 2 || format.bytesPerPixel == 4);
+	_outputPixelFormat = format;
+}
+
 PNGDecoder::~PNGDecoder() {
 	destroy();
 }
@@ -99,6 +107,9 @@ bool PNGDecoder::loadStream(Common::SeekableReadStream &stream) {
 #ifdef USE_PNG
 	destroy();
 
+	const uint32 startTime = g_system->getMillis();
+	const int32 startPos = stream.pos();
+
 	// First, check the PNG signature (if not set to skip it)
 	if (!_skipSignature) {
 		if (stream.readUint32BE() != MKTAG(0x89, 'P', 'N', 'G')) {
@@ -150,6 +161,9 @@ bool PNGDecoder::loadStream(Common::SeekableReadStream &stream) {
 	// To keep memory framentation low this happens before allocating memory for temporary image data.
 	_outputSurface = new Graphics::Surface();
 
+	// The format libpng hands us the rows in, for true color images
+	Graphics::PixelFormat rowFormat;
+
 	// Images of all color formats except PNG_COLOR_TYPE_PALETTE
 	// will be transformed into ARGB images
 	if (colorType == PNG_COLOR_TYPE_PALETTE && !png_get_valid(pngPtr, infoPtr, PNG_INFO_tRNS)) {
@@ -176,8 +190,15 @@ bool PNGDecoder::loadStream(Common::SeekableReadStream &stream) {
 			isAlpha = true;
 			png_set_expand(pngPtr);
 		}
-		_outputSurface->create(width, height, Graphics::PixelFormat(4,
-		                       8, 8, 8, isAlpha ? 8 : 0, 24, 16, 8, 0));
+		rowFormat = Graphics::PixelFormat(4, 8, 8, 8, isAlpha ? 8 : 0, 24, 16, 8, 0);
+
+		// Interlaced images have to be fully decoded before they can be
+		// converted, so they get converted after decoding instead.
+		if (_outputPixelFormat.bytesPerPixel != 0 && interlaceType == PNG_INTERLACE_NONE)
+			_outputSurface->create(width, height, _outputPixelFormat);
+		else
+			_outputSurface->create(width, height, rowFormat);
+
 		if (!_outputSurface->getPixels()) {
 			error("Could not allocate memory for output image.");
 		}
@@ -209,7 +230,18 @@ bool PNGDecoder::loadStream(Common::SeekableReadStream &stream) {
 	width = w;
 	height = h;
 
-	if (interlaceType == PNG_INTERLACE_NONE) {
+	if (interlaceType == PNG_INTERLACE_NONE && rowFormat.bytesPerPixel != 0 && rowFormat != _outputSurface->format) {
+		// Convert each row to the requested format as soon as it is read
+		byte *rowBuffer = new byte[width * rowFormat.bytesPerPixel];
+
+		for (int i = 0; i < height; i++) {
+			png_read_row(pngPtr, rowBuffer, NULL);
+			Graphics::crossBlit((byte *)_outputSurface->getBasePtr(0, i), rowBuffer, _outputSurface->pitch,
+			                    width * rowFormat.bytesPerPixel, width, 1, _outputSurface->format, rowFormat);
+		}
+
+		delete[] rowBuffer;
+	} else if (interlaceType == PNG_INTERLACE_NONE) {
 		// PNGs without interlacing can simply be read row by row.
 		for (int i = 0; i < height; i++) {
 			png_read_row(pngPtr, (png_bytep)_outputSurface->getBasePtr(0, i), NULL);
@@ -241,6 +273,13 @@ bool PNGDecoder::loadStream(Common::SeekableReadStream &stream) {
 	// Destroy libpng structures
 	png_destroy_read_struct(&pngPtr, &infoPtr, &endInfo);
 
+	// Interlaced images could not be converted while decoding
+	if (_outputPixelFormat.bytesPerPixel != 0 && _outputSurface->format.bytesPerPixel != 1)
+		_outputSurface->convertToInPlace(_outputPixelFormat);
+
+	debug(4, "PNGDecoder: Decoded %dx%d image from %d bytes in %d ms", width, height,
+	      stream.pos() - startPos, g_system->getMillis() - startTime);
+
 	return true;
 #else
 	return false;
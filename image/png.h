@@ -33,6 +33,7 @@
 
 #include "common/scummsys.h"
 #include "common/textconsole.h"
+#include "graphics/pixelformat.h"
 #include "image/image_decoder.h"
 
 namespace Common {
@@ -57,6 +58,18 @@ public:
 	const byte *getPalette() const { return _palette; }
 	uint16 getPaletteColorCount() const { return _paletteColorCount; }
 	void setSkipSignature(bool skip) { _skipSignature = skip; }
+
+	/**
+	 * Request the pixel format of the decoded surface.
+	 *
+	 * Rows are converted to this format as they are decoded, which avoids
+	 * a separate conversion pass over the whole image afterwards. This
+	 * only applies to true color images; palettized images are always
+	 * output as CLUT8. The format needs to have 2 or 4 bytes per pixel.
+	 *
+	 * By default, images are output in 32bpp ARGB or XRGB.
+	 */
+	void setOutputPixelFormat(const Graphics::PixelFormat &format);
 private:
 	byte *_palette;
 	uint16 _paletteColorCount;
@@ -64,6 +77,9 @@ private:
 	// flag to skip the png signature check for headless png files
 	bool _skipSignature;
 
+	// the requested output format, if any
+	Graphics::PixelFormat _outputPixelFormat;
+
 	Graphics::Surface *_outputSurface;
 };
 
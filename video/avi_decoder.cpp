@@ -20,6 +20,8 @@
  *
  */
 
+#include "common/bufferedstream.h"
+#include "common/memstream.h"
 #include "common/stream.h"
 #include "common/system.h"
 #include "common/textconsole.h"
@@ -39,6 +41,9 @@
 
 namespace Video {
 
+// Size of the read-ahead buffer used while demuxing
+static const uint32 kReadAheadSize = 64 * 1024;
+
 #define UNKNOWN_HEADER(a) error("Unknown header found -- \'%s\'", tag2str(a))
 
 // IDs used throughout the AVI files
@@ -380,6 +385,13 @@ bool AVIDecoder::loadStream(Common::SeekableReadStream *stream) {
 		return false;
 	}
 
+	// Demuxing hops between the interleaved chunks of each track, reading
+	// a few bytes of chunk header at a time. Read ahead through a buffer
+	// so this doesn't turn into lots of small reads on the file, unless
+	// the whole file is already in memory.
+	if (!dynamic_cast<Common::MemoryReadStream *>(_fileStream))
+		_fileStream = Common::wrapBufferedSeekableReadStream(_fileStream, kReadAheadSize, DisposeAfterUse::YES);
+
 	// Create the status entries
 	uint32 index = 0;
 	for (TrackListIterator it = getTrackListBegin(); it != getTrackListEnd(); it++, index++) {
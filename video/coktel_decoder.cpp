@@ -714,17 +714,21 @@ bool PreIMDDecoder::seek(int32 frame, int whence, bool restart) {
 		// Nothing to do
 		return true;
 
-	// Run through the frames
-	_curFrame = -1;
-	_stream->seek(2);
-	while (_curFrame != frame) {
-		uint16 frameSize = _stream->readUint16LE();
+	// PreIMDs have no frame index, so we need to run through the frames.
+	// Start from the furthest frame we already know the position of.
+	while ((int32)_framePos.size() <= (frame + 1)) {
+		_stream->seek(_framePos.back());
 
-		_stream->skip(frameSize + 2);
+		uint16 frameSize = _stream->readUint16LE();
+		if (_stream->eos())
+			return false;
 
-		_curFrame++;
+		_framePos.push_back(_framePos.back() + frameSize + 4);
 	}
 
+	_stream->seek(_framePos[frame + 1]);
+	_curFrame = frame;
+
 	return true;
 }
 
@@ -741,6 +745,10 @@ bool PreIMDDecoder::loadStream(Common::SeekableReadStream *stream) {
 
 	_frameCount = _stream->readUint16LE();
 
+	// The first frame directly follows the frame count
+	_framePos.clear();
+	_framePos.push_back(_stream->pos());
+
 	_videoBufferSize = _width * _height;
 	_videoBuffer     = new byte[_videoBufferSize];
 
@@ -758,6 +766,8 @@ void PreIMDDecoder::close() {
 
 	_stream = 0;
 
+	_framePos.clear();
+
 	_videoBuffer     = 0;
 	_videoBufferSize = 0;
 }
@@ -784,6 +794,10 @@ const Graphics::Surface *PreIMDDecoder::decodeNextFrame() {
 void PreIMDDecoder::processFrame() {
 	_curFrame++;
 
+	// Remember where this frame is, for seeking
+	if ((int32)_framePos.size() == _curFrame)
+		_framePos.push_back(_stream->pos());
+
 	uint16 frameSize = _stream->readUint16LE();
 	if (_stream->eos() || (frameSize == 0))
 		return;
@@ -942,12 +956,15 @@ bool IMDDecoder::seek(int32 frame, int whence, bool restart) {
 
 	} else if (restart && (_soundStage == kSoundNone)) {
 		// If we are asked to restart the video if necessary and have no
-		// audio to worry about, restart the video and run through the frames
+		// audio to worry about, run through the frames. Only restart the
+		// video if the frame is already behind us.
 
-		_curFrame = 0;
-		_stream->seek(_firstFramePos);
+		if (frame < _curFrame) {
+			_curFrame = -1;
+			_stream->seek(_firstFramePos);
+		}
 
-		for (int i = ((frame > _curFrame) ? _curFrame : 0); i <= frame; i++)
+		for (int32 i = _curFrame; i < frame; i++)
 			processFrame();
 
 		return true;
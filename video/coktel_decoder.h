@@ -293,6 +293,8 @@ public:
 private:
 	Common::SeekableReadStream *_stream;
 
+	Common::Array<uint32> _framePos; ///< Positions of the frames seen so far.
+
 	// Buffer for processed frame data
 	byte  *_videoBuffer;
 	uint32 _videoBufferSize;